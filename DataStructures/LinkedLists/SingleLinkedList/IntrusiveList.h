@@ -0,0 +1,175 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      IntrusiveList.h
+ * Project:   SingleLinkedList
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *    Intrusive version of the Single Linked List
+ *    The objects carry their own next pointer, so the list never
+ *    allocates a Node, it only links objects which already exist
+ *    (for example in a pool or an array)
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef _INTRUSIVELIST_H_
+#define _INTRUSIVELIST_H_
+
+/**
+ * IntrusiveList holds the head and tail pointers, just like List
+ *
+ *  T     - Type of the objects in the list
+ *  Next  - Member of T which links to the next object, T::next by default
+ *
+ *  struct Order
+ *  {
+ *    int value;
+ *    Order *next = nullptr;
+ *  };
+ *  IntrusiveList<Order> orders;
+ *
+ * An object can be in only one list (per hook) at a time
+ * The list does not own the objects, they must outlive their time in it
+ */
+template <typename T, T *T::*Next = &T::next>
+class IntrusiveList
+{
+private:
+  T *head;
+  T *tail;
+
+public:
+  IntrusiveList()
+  {
+    head = nullptr;
+    tail = nullptr;
+  }
+
+  /*
+   *---------------------------------------------------------------------
+   * List operations
+   *  addToBack()       - Link an object at the end of the list
+   *  addToFront()      - Link an object at the beginning of the list
+   *  addAfter()        - Link an object after one already in the list
+   *  removeFromFront() - Unlink the first object
+   *  removeAfter()     - Unlink the object after a known one
+   *  front(), back()   - First and last object, nullptr if empty
+   *  next()            - Object after the given one, nullptr at the end
+   *  isEmpty()         - Whether there is anything in the list
+   *
+   *  All operations are O(1) and never allocate
+   *---------------------------------------------------------------------
+   */
+
+  /**
+     * Link an object at the end of the list
+     */
+  void addToBack(T &item)
+  {
+    item.*Next = nullptr;
+
+    // Check if this is the first object
+    if (nullptr == head)
+    {
+      // Make head and tail both point to this object
+      head = &item;
+      tail = &item;
+      return;
+    }
+
+    // This is not the first object, so add it after tail
+    tail->*Next = &item;
+    tail = &item;
+  }
+
+  /**
+     * Link an object at the beginning of the list
+     */
+  void addToFront(T &item)
+  {
+    // If this is the first object, make it head and tail
+    item.*Next = head;
+    if (nullptr == head)
+      tail = &item;
+    head = &item;
+  }
+
+  /**
+     * Link an object right after one which is already in the list
+     */
+  void addAfter(T &previous, T &item)
+  {
+    item.*Next = previous.*Next;
+    previous.*Next = &item;
+    if (tail == &previous)
+      tail = &item;
+  }
+
+  /**
+     * Unlink the first object
+     * return value is the object removed, nullptr if the list was empty
+     */
+  T *removeFromFront()
+  {
+    T *removed = head;
+    if (nullptr == removed)
+      return nullptr;
+
+    head = removed->*Next;
+    if (nullptr == head)
+      tail = nullptr;
+    removed->*Next = nullptr;
+    return removed;
+  }
+
+  /**
+     * Unlink the object after previous
+     * return value is the object removed, nullptr if previous was the last
+     */
+  T *removeAfter(T &previous)
+  {
+    T *removed = previous.*Next;
+    if (nullptr == removed)
+      return nullptr;
+
+    previous.*Next = removed->*Next;
+
+    // If we removed the last object, previous is the new tail
+    if (tail == removed)
+      tail = &previous;
+    removed->*Next = nullptr;
+    return removed;
+  }
+
+  T *front() const { return head; }
+  T *back() const { return tail; }
+  T *next(const T &item) const { return item.*Next; }
+  bool isEmpty() const { return nullptr == head; }
+
+  /**
+   * Forward iterator, so the list can be used in range based for
+   */
+  class Iterator
+  {
+    T *current;
+
+  public:
+    Iterator(T *start) : current(start) {}
+    T &operator*() const { return *current; }
+    T *operator->() const { return current; }
+    Iterator &operator++()
+    {
+      current = current->*Next;
+      return *this;
+    }
+    bool operator!=(const Iterator &other) const { return current != other.current; }
+  };
+
+  Iterator begin() const { return Iterator(head); }
+  Iterator end() const { return Iterator(nullptr); }
+};
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      benchmark.cpp
+ * Project:   SingleLinkedList
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Cost of building a list of objects which already live in a pool
+ *    List          - addToBack/addToFront allocate a Node per value
+ *    IntrusiveList - the objects carry their own next pointer
+ *
+ *  Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+ *  Usage: ./benchmark [items] [rounds]
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "SingleLinkedList.h"
+#include "IntrusiveList.h"
+using namespace std;
+
+// Count every allocation made by new
+static size_t allocations = 0;
+
+void *operator new(size_t size)
+{
+  allocations++;
+  if (void *memory = malloc(size))
+    return memory;
+  throw bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+  free(memory);
+}
+
+// Object from the pool, with the hook for IntrusiveList
+struct Order
+{
+  int value;
+  Order *next = nullptr;
+};
+
+// Time one way of building the list, print ns per item and allocations
+template <typename Build>
+void measure(const char *name, size_t items, int rounds, Build build)
+{
+  size_t allocationsBefore = allocations;
+  auto started = chrono::steady_clock::now();
+  long checksum = 0;
+
+  for (int round = 0; round < rounds; round++)
+    checksum += build();
+
+  chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - started;
+  cout << setw(28) << left << name << right
+       << setw(8) << fixed << setprecision(2) << elapsed.count() / (items * rounds) << " ns/item"
+       << setw(12) << allocations - allocationsBefore << " allocations"
+       << "   (" << checksum << ")" << endl;
+}
+
+int main(int argc, char **argv)
+{
+  size_t items = argc > 1 ? atol(argv[1]) : 1000000;
+  int rounds = argc > 2 ? atoi(argv[2]) : 5;
+
+  // The pool, allocated once up front
+  vector<Order> pool(items);
+  for (size_t i = 0; i < items; i++)
+    pool[i].value = i;
+
+  // List has no way to free its nodes, so they stay allocated
+  measure("List::addToBack", items, rounds, [&] {
+    List list;
+    for (auto &order : pool)
+      list.addToBack(order.value);
+    return 0L;
+  });
+
+  measure("List::addToFront", items, rounds, [&] {
+    List list;
+    for (auto &order : pool)
+      list.addToFront(order.value);
+    return 0L;
+  });
+
+  measure("IntrusiveList::addToBack", items, rounds, [&] {
+    IntrusiveList<Order> list;
+    for (auto &order : pool)
+      list.addToBack(order);
+    return 0L;
+  });
+
+  measure("IntrusiveList::addToFront", items, rounds, [&] {
+    IntrusiveList<Order> list;
+    for (auto &order : pool)
+      list.addToFront(order);
+    return 0L;
+  });
+
+  // Build, walk and take apart again, still without allocating
+  measure("IntrusiveList build+walk", items, rounds, [&] {
+    IntrusiveList<Order> list;
+    long sum = 0;
+
+    for (auto &order : pool)
+      list.addToBack(order);
+    for (auto &order : list)
+      sum += order.value;
+
+    // Every other order is cancelled, then the rest are served
+    for (Order *order = list.front(); order && list.next(*order); order = list.next(*order))
+      list.removeAfter(*order);
+    while (Order *order = list.removeFromFront())
+      sum -= order->value;
+
+    return sum;
+  });
+}
@@ -13,22 +13,40 @@
  *    rebalance method checks the balance field in node and calls on of the 
  *    four rotation methods, which also resets the balance after rotation.
  * 
+ *    Keys are compared once per level with a three-way comparator (<=>).
+ *    With a transparent comparator (the default compare_three_way) keys
+ *    can be looked up with a cheaper type, e.g. string_view in a tree of
+ *    string, without building a temporary key.
+ * 
+ *    Requires C++20
+ * 
  * Revision History:
  *    2018-May-23: Initial Creation
+ *    2026-Oct-18: Generic key and three-way comparator, find and contains
  * 
  * Disclaimer:
  *    This code may contain intentional and unintentional bugs
  *    There are no warranties of the code working correctly
  *----------------------------------------------------------------------------*/
 
-#include <iostream> // Required for cout
-#include <iomanip>  // Required for setw
+#include <iostream>    // Required for cout
+#include <iomanip>     // Required for setw
+#include <compare>     // Required for compare_three_way
+#include <concepts>    // Required for same_as, invocable
+#include <functional>  // Required for invoke
+#include <utility>     // Required for move
+#include <type_traits> // Required for is_scalar_v
 using namespace std;
 
 /**
  * AVL Tree class
  * which is a self balancing tree and achieves O(log n) operation
  * 
+ *  Key       - Type of the values stored, int by default
+ *  Compare   - Three-way comparator, returns an ordering like <=>
+ *              If it has is_transparent, find and contains accept
+ *              any type it can compare against Key
+ * 
  * It contains the following methods
  * 
  *  Regular BST methods
@@ -36,6 +54,9 @@ using namespace std;
  *      add                 - Data abstractor wrapper for addNode
  *      removeNode          - Remove a node and rebalance if necessary
  *      remove              - Data abstractor wrapper for removeNode
+ *      findNode            - Search with one comparison per level
+ *      find                - Data abstractor, pointer to the key or nullptr
+ *      contains            - Data abstractor, whether the key is present
  *      inorderAscending    - Print the tree in ascending order
  *      printAscending      - Data abstractor method for inorder
  *      inorderDebug        - Print the tree in tree form
@@ -49,6 +70,7 @@ using namespace std;
  *      rotateLR    - rotate the subtree left once and then right
  * 
  */
+template <typename Key = int, typename Compare = compare_three_way>
 class Tree
 {
   /**
@@ -59,21 +81,29 @@ class Tree
     // If using an earlier version of C++ compiler
     // Move the initialization of left and right into constructor
     Node *left = nullptr;
-    int value;
+    Key value;
     Node *right = nullptr;
 
     // balance of the Node
     int balance = 0;
 
-    Node(int val)
+    Node(Key val) : value(std::move(val))
     {
-      value = val;
     }
   };
 
 private:
   Node *root = nullptr;
 
+  // Three-way comparator, takes no space when it has no state
+  [[no_unique_address]] Compare compare;
+
+public:
+  explicit Tree(Compare compare = Compare()) : compare(compare)
+  {
+  }
+
+private:
   /**
     * All the AVL methods are listed below
     * 
@@ -176,8 +206,9 @@ private:
     grandchild->right = child;
 
     // Set the new balances
-    current->balance = -min(grandchild->balance, 0);
-    child->balance = -max(grandchild->balance, 0);
+    // current got grandchild's left, which is shorter if grandchild was right heavy
+    current->balance = -max(grandchild->balance, 0);
+    child->balance = -min(grandchild->balance, 0);
     grandchild->balance = 0;
 
     // Grandchild becomes the parent
@@ -218,8 +249,9 @@ private:
     grandchild->right = current;
 
     // Reset child balance
-    current->balance = -max(grandchild->balance, 0);
-    child->balance = -min(grandchild->balance, 0);
+    // current got grandchild's right, which is shorter if grandchild was left heavy
+    current->balance = -min(grandchild->balance, 0);
+    child->balance = -max(grandchild->balance, 0);
     grandchild->balance = 0;
 
     // Grandchild becomes the parent
@@ -234,7 +266,7 @@ private:
     */
 private:
   // Internal method for adding a node, which uses Node *root
-  Node *addNode(Node *current, int valToAdd, bool &heightIncreased)
+  Node *addNode(Node *current, const Key &valToAdd, bool &heightIncreased)
   {
     // If we have reached null node, create a new node and return it
     // It will not be connected here, but at the previous level
@@ -246,13 +278,15 @@ private:
 
     // If we haven't reached null, go down the tree
     // and connect the returned pointer to either left of right
-    if (valToAdd > current->value)
+    // One comparison tells us which way (or that it already exists)
+    auto order = invoke(compare, valToAdd, current->value);
+    if (order > 0)
     {
       current->right = addNode(current->right, valToAdd, heightIncreased);
       if (heightIncreased)
         current->balance++;
     }
-    else if (valToAdd < current->value)
+    else if (order < 0)
     {
       current->left = addNode(current->left, valToAdd, heightIncreased);
       if (heightIncreased)
@@ -271,7 +305,7 @@ private:
 
 public:
   // Data abstraction method for adding a node
-  void add(int valToAdd)
+  void add(const Key &valToAdd)
   {
     // Call the private method and pass root
     bool heightIncreased = false;
@@ -280,10 +314,8 @@ public:
 
 private:
   // Internal method for removing a node
-  Node *removeNode(Node *current, int valToRemove, bool &heightDecreased)
+  Node *removeNode(Node *current, const Key &valToRemove, bool &heightDecreased)
   {
-    int priorBalance = 0;
-
     // If we have reached null node, it means it was not found
     if (nullptr == current)
     {
@@ -292,7 +324,8 @@ private:
     }
 
     // Now search the value down the tree
-    if (valToRemove > current->value)
+    auto order = invoke(compare, valToRemove, current->value);
+    if (order > 0)
     {
       current->right = removeNode(current->right, valToRemove, heightDecreased);
       if (heightDecreased == true)
@@ -307,7 +340,7 @@ private:
           heightDecreased = false;
       }
     }
-    else if (valToRemove < current->value)
+    else if (order < 0)
     {
       current->left = removeNode(current->left, valToRemove, heightDecreased);
       if (heightDecreased == true)
@@ -387,7 +420,8 @@ private:
 
       // But now we have the same value twice in the tree
       // We can remove the successor instead, by calling removeNode
-      current->right = removeNode(current->right, successor->value, heightDecreased);
+      // Pass our copy, as the successor node gets deleted on the way
+      current->right = removeNode(current->right, current->value, heightDecreased);
       if (heightDecreased == true)
       {
         current->balance--;
@@ -397,19 +431,112 @@ private:
     }
 
     // AVL: Change required for AVL balance tree
+    // A rotation can make the subtree shorter, in which case its
+    // new root is balanced and the parent has to know about it
+    bool rotated = current->balance == +2 || current->balance == -2;
     current = rebalance(current);
+    if (rotated)
+      heightDecreased = (0 == current->balance);
 
     return current;
   }
 
 public:
   // Data Abstractor method for remove
-  void remove(int valToRemove)
+  void remove(const Key &valToRemove)
   {
     bool heightDecreased = false;
     root = removeNode(root, valToRemove, heightDecreased);
   }
 
+private:
+  // Lookups may use another type only if the comparator is transparent
+  // and can compare it against Key
+  template <typename K>
+  static constexpr bool canLookup =
+      same_as<K, Key> ||
+      (requires { typename Compare::is_transparent; } &&
+       invocable<const Compare &, const K &, const Key &>);
+
+  // benchmark.cpp times the different Walks of findNode through this
+  friend struct TreeBenchmark;
+
+  /**
+   * How findNode walks down the tree, find and contains always use Auto
+   *  Auto        - BranchFree for scalar keys, Branchy for the rest
+   *  Branchy     - One comparison, branch on its result
+   *  BranchFree  - One comparison, index the children with its result
+   *  TwoCompare  - Compare for greater, then again for less, the way
+   *                addNode and removeNode still do it
+   */
+  enum class Walk
+  {
+    Auto,
+    Branchy,
+    BranchFree,
+    TwoCompare
+  };
+
+  // Internal method for searching, loop instead of recursion
+  template <Walk walk, typename K>
+  Node *findNode(const K &valToFind) const
+  {
+    // For cheap keys pick the child by indexing, not by branching on
+    // the direction, which is a coin toss for the branch predictor.
+    // When comparing is itself a memory access (string) a branch is
+    // faster, as the CPU can start loading the next node speculatively
+    constexpr bool branchFree =
+        walk == Walk::BranchFree || (walk == Walk::Auto && is_scalar_v<Key>);
+
+    Node *current = root;
+
+    while (current)
+    {
+      if constexpr (walk == Walk::TwoCompare)
+      {
+        if (invoke(compare, valToFind, current->value) > 0)
+          current = current->right;
+        else if (invoke(compare, valToFind, current->value) < 0)
+          current = current->left;
+        else
+          return current;
+        continue;
+      }
+
+      // One comparison per level
+      auto order = invoke(compare, valToFind, current->value);
+      if (order == 0)
+        return current;
+
+      if constexpr (branchFree)
+      {
+        Node *children[2] = {current->left, current->right};
+        current = children[order > 0];
+      }
+      else
+        current = order > 0 ? current->right : current->left;
+    }
+    return nullptr;
+  }
+
+public:
+  // Data abstractor for findNode, returns the stored key or nullptr
+  template <typename K>
+    requires canLookup<K>
+  const Key *find(const K &valToFind) const
+  {
+    Node *found = findNode<Walk::Auto>(valToFind);
+    return found ? &found->value : nullptr;
+  }
+
+  // Data abstractor for findNode, checks whether the key is in the tree
+  template <typename K>
+    requires canLookup<K>
+  bool contains(const K &valToFind) const
+  {
+    return nullptr != findNode<Walk::Auto>(valToFind);
+  }
+
 private:
   // inorderAscending method for printing the tree
   void inorderAscending(Node *current)
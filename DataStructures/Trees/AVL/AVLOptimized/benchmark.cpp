@@ -0,0 +1,155 @@
+/*-----------------------------------------------------------------------------*
+ * Project:   OptimizedAVLTree
+ * File:      benchmark.cpp
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *    Lookup speed of the AVL tree against std::set
+ *      - random int keys
+ *      - string keys looked up with string_view (no temporary string)
+ *        and with a temporary string built for every lookup
+ *    For both key types every Walk of findNode is timed as well, i.e.
+ *    branchy vs branch-free child selection and the two-comparison walk
+ *
+ *    Build: g++ -std=c++20 -O2 benchmark.cpp -o benchmark
+ *    Usage: ./benchmark [keys] [lookups]
+ *
+ * Revision History:
+ *    2026-Oct-18: Initial Creation
+ *    2026-Oct-18: Time each Walk of findNode
+ *
+ * Disclaimer:
+ *    This code may contain intentional and unintentional bugs
+ *    There are no warranties of the code working correctly
+ *----------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "AVLOptimized.h"
+
+// Time a lookup loop, print ns per lookup and the number of hits
+template <typename Lookup>
+void measure(const char *name, size_t lookups, Lookup lookup)
+{
+  auto started = chrono::steady_clock::now();
+  size_t hits = lookup();
+  chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - started;
+
+  cout << setw(32) << left << name << right
+       << setw(10) << fixed << setprecision(1) << elapsed.count() / lookups << " ns"
+       << setw(12) << hits << " hits" << endl;
+}
+
+// Friend of Tree, so it can time the Walks which find and contains don't use
+struct TreeBenchmark
+{
+  template <typename AVLTree, typename Queries>
+  static void walks(const AVLTree &tree, const Queries &queries)
+  {
+    using Walk = typename AVLTree::Walk;
+    measure("Tree::findNode<Branchy>", queries.size(), [&] { return countHits<Walk::Branchy>(tree, queries); });
+    measure("Tree::findNode<BranchFree>", queries.size(), [&] { return countHits<Walk::BranchFree>(tree, queries); });
+    measure("Tree::findNode<TwoCompare>", queries.size(), [&] { return countHits<Walk::TwoCompare>(tree, queries); });
+  }
+
+  // Count how many queries are in the tree, walking it the given way
+  template <auto walk, typename AVLTree, typename Queries>
+  static size_t countHits(const AVLTree &tree, const Queries &queries)
+  {
+    size_t hits = 0;
+    for (const auto &query : queries)
+      hits += nullptr != tree.template findNode<walk>(query);
+    return hits;
+  }
+};
+
+int main(int argc, char **argv)
+{
+  size_t keys = argc > 1 ? atol(argv[1]) : 1 << 20;
+  size_t lookups = argc > 2 ? atol(argv[2]) : 1 << 21;
+  mt19937_64 random(2018);
+
+  // Random int keys, half the lookups miss
+  {
+    Tree<int> tree;
+    set<int> stdSet;
+    vector<int> queries(lookups);
+
+    for (size_t i = 0; i < keys; i++)
+    {
+      int key = random() % (keys * 2) + 1;
+      tree.add(key);
+      stdSet.insert(key);
+    }
+    for (auto &query : queries)
+      query = random() % (keys * 2) + 1;
+
+    cout << "int keys: " << stdSet.size() << endl;
+    measure("Tree::contains", lookups, [&] {
+      size_t hits = 0;
+      for (int query : queries)
+        hits += tree.contains(query);
+      return hits;
+    });
+    TreeBenchmark::walks(tree, queries);
+    measure("set::find", lookups, [&] {
+      size_t hits = 0;
+      for (int query : queries)
+        hits += stdSet.find(query) != stdSet.end();
+      return hits;
+    });
+  }
+
+  // String keys, queries are views into one buffer
+  {
+    Tree<string> tree;
+    set<string, less<>> stdSet;
+    string buffer;
+    vector<string_view> queries(lookups);
+
+    auto makeKey = [&] { return "customer/" + to_string(random() % (keys * 2)) + "/orders"; };
+
+    for (size_t i = 0; i < keys; i++)
+    {
+      string key = makeKey();
+      tree.add(key);
+      stdSet.insert(key);
+    }
+
+    vector<pair<size_t, size_t>> spans;
+    for (size_t i = 0; i < lookups; i++)
+    {
+      string key = makeKey();
+      spans.emplace_back(buffer.size(), key.size());
+      buffer += key;
+    }
+    for (size_t i = 0; i < lookups; i++)
+      queries[i] = string_view(buffer).substr(spans[i].first, spans[i].second);
+
+    cout << "string keys: " << stdSet.size() << endl;
+    measure("Tree::contains(string_view)", lookups, [&] {
+      size_t hits = 0;
+      for (auto query : queries)
+        hits += tree.contains(query);
+      return hits;
+    });
+    TreeBenchmark::walks(tree, queries);
+    measure("Tree::contains(string(view))", lookups, [&] {
+      size_t hits = 0;
+      for (auto query : queries)
+        hits += tree.contains(string(query));
+      return hits;
+    });
+    measure("set<less<>>::find(string_view)", lookups, [&] {
+      size_t hits = 0;
+      for (auto query : queries)
+        hits += stdSet.find(query) != stdSet.end();
+      return hits;
+    });
+  }
+}
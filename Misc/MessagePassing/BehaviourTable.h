@@ -0,0 +1,277 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      BehaviourTable.h
+ * Project:   MessagePassing
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Copy-on-write behaviour table which can be changed while other
+ *  threads are dispatching messages (RCU style)
+ *
+ *  Readers never lock: they announce the current epoch, load the table
+ *  pointer and look up the receiver. Writers copy the table, change the
+ *  copy and publish it with an atomic pointer swap. The old table is
+ *  retired and deleted once no reader can still be looking at it.
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef _BEHAVIOURTABLE_H_
+#define _BEHAVIOURTABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <initializer_list>
+using namespace std;
+
+/**
+ * EpochDomain tracks which epoch every reading thread is in
+ *
+ *  - globalEpoch moves forward each time a table is retired
+ *  - A reader claims a free slot for the length of its read and writes
+ *    the epoch it started in there, 0 means the slot is free
+ *  - A retired table can be deleted once every active slot
+ *    has moved past the epoch in which the table was retired
+ *
+ * Up to maxReaders threads can be inside dispatch() at the same moment
+ * with a slot each. Any more readers at that moment are counted in
+ * overflowReaders instead. While that count is not 0 nothing is
+ * reclaimed, so retired tables just wait a little longer.
+ */
+class EpochDomain
+{
+public:
+  // Number of readers at the same moment which get their own slot
+  static constexpr int maxReaders = 128;
+
+private:
+  // Each slot sits on its own cache line so readers don't disturb each other
+  struct alignas(64) Slot
+  {
+    atomic<uint64_t> epoch{0};
+  };
+
+  static Slot slots[maxReaders];
+  static inline atomic<uint64_t> globalEpoch{1};
+  alignas(64) static inline atomic<int> overflowReaders{0};
+
+  // What the current thread is doing, slot is nullptr if it overflowed
+  struct ReaderState
+  {
+    Slot *slot = nullptr;
+    int depth = 0; // Nested reads (a behaviour sending a message)
+    int hint = -1; // Slot this thread used last time, usually still free
+  };
+
+  static ReaderState &reader()
+  {
+    thread_local ReaderState state;
+    return state;
+  }
+
+public:
+  /**
+   * ReadGuard marks the current thread as reading for its lifetime
+   * Entering tries at most maxReaders slots, then falls back to the
+   * overflow count, so it never waits for another thread
+   */
+  class ReadGuard
+  {
+    ReaderState &self;
+
+  public:
+    ReadGuard() : self(reader())
+    {
+      // Only the outermost read announces an epoch
+      if (0 != self.depth++)
+        return;
+
+      if (self.hint < 0)
+        self.hint = int(hash<thread::id>()(this_thread::get_id()) % maxReaders);
+
+      // Claiming the slot and announcing the epoch is one CAS
+      // seq_cst so the announcement is visible before the table is loaded
+      uint64_t epoch = globalEpoch.load();
+      for (int i = 0; i < maxReaders; i++)
+      {
+        int index = (self.hint + i) % maxReaders;
+        uint64_t expected = 0;
+        if (slots[index].epoch.compare_exchange_strong(expected, epoch))
+        {
+          self.slot = &slots[index];
+          self.hint = index;
+          return;
+        }
+      }
+
+      // Every slot is taken, hold back reclamation instead
+      self.slot = nullptr;
+      overflowReaders.fetch_add(1);
+    }
+
+    ~ReadGuard()
+    {
+      if (0 != --self.depth)
+        return;
+
+      if (self.slot)
+        self.slot->epoch.store(0, memory_order_release);
+      else
+        overflowReaders.fetch_sub(1, memory_order_release);
+    }
+
+    ReadGuard(const ReadGuard &) = delete;
+    ReadGuard &operator=(const ReadGuard &) = delete;
+  };
+
+  // Move to the next epoch and return the one we just left
+  static uint64_t advance()
+  {
+    return globalEpoch.fetch_add(1);
+  }
+
+  // Oldest epoch any reader is still in (UINT64_MAX if nobody is reading)
+  // Overflow readers don't say which epoch they are in, so assume the oldest
+  static uint64_t oldestActive()
+  {
+    if (overflowReaders.load() > 0)
+      return 0;
+
+    uint64_t oldest = UINT64_MAX;
+    for (auto &slot : slots)
+    {
+      uint64_t epoch = slot.epoch.load();
+      if (epoch != 0 && epoch < oldest)
+        oldest = epoch;
+    }
+    return oldest;
+  }
+};
+
+// Defined outside as Slot must be complete first
+inline EpochDomain::Slot EpochDomain::slots[EpochDomain::maxReaders];
+
+/**
+ * BehaviourTable maps receiver names ("eat", "sleep") to behaviours
+ *
+ *  dispatch()  - Look up a receiver and call it, lock-free and wait-free
+ *  learn()     - Add or replace a behaviour
+ *  forget()    - Remove a behaviour
+ *
+ * Only writers reclaim. A replaced table (and the behaviours in it) stays
+ * alive until a later learn() or forget() finds no reader can see it,
+ * or until the BehaviourTable is destroyed
+ */
+template <typename Behaviour>
+class BehaviourTable
+{
+  using Table = map<string, Behaviour>;
+
+private:
+  // Table currently seen by readers
+  atomic<const Table *> current;
+
+  // Writers are serialized among themselves, readers never take this
+  mutex writerLock;
+
+  // Old tables waiting for readers to move on, with the epoch they were retired in
+  vector<pair<uint64_t, const Table *>> retired;
+
+public:
+  BehaviourTable(initializer_list<typename Table::value_type> behaviours)
+      : current(new Table(behaviours))
+  {
+  }
+
+  // No readers can be left when the owner is destroyed
+  ~BehaviourTable()
+  {
+    delete current.load();
+    for (auto &oldTable : retired)
+      delete oldTable.second;
+  }
+
+  BehaviourTable(const BehaviourTable &) = delete;
+  BehaviourTable &operator=(const BehaviourTable &) = delete;
+
+  /**
+   * Find the receiver and call it with args
+   * return value indicates whether the receiver was found
+   */
+  template <typename... Args>
+  bool dispatch(const string &receiverName, Args &&...args) const
+  {
+    EpochDomain::ReadGuard guard;
+
+    // Unlike map::operator[], find() never modifies the table
+    const Table *table = current.load();
+    auto receiver = table->find(receiverName);
+    if (receiver == table->end() || !receiver->second)
+      return false;
+
+    receiver->second(std::forward<Args>(args)...);
+    return true;
+  }
+
+  // Add a new behaviour or replace an existing one
+  void learn(const string &receiverName, Behaviour behaviour)
+  {
+    lock_guard<mutex> lock(writerLock);
+
+    Table *next = new Table(*current.load());
+    (*next)[receiverName] = std::move(behaviour);
+    publish(next);
+  }
+
+  // Remove a behaviour, return value indicates whether it existed
+  bool forget(const string &receiverName)
+  {
+    lock_guard<mutex> lock(writerLock);
+
+    if (0 == current.load()->count(receiverName))
+      return false;
+
+    Table *next = new Table(*current.load());
+    next->erase(receiverName);
+    publish(next);
+    return true;
+  }
+
+private:
+  // Swap in the new table and retire the old one, writerLock must be held
+  void publish(const Table *next)
+  {
+    const Table *old = current.exchange(next);
+
+    // Readers which can still see old announced this epoch or an earlier one
+    retired.emplace_back(EpochDomain::advance(), old);
+    reclaim();
+  }
+
+  // Delete retired tables which no reader can be looking at any more
+  void reclaim()
+  {
+    uint64_t oldest = EpochDomain::oldestActive();
+
+    auto keep = retired.begin();
+    for (auto &oldTable : retired)
+    {
+      if (oldTable.first < oldest)
+        delete oldTable.second;
+      else
+        *keep++ = oldTable;
+    }
+    retired.erase(keep, retired.end());
+  }
+};
+
+#endif
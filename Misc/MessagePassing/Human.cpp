@@ -6,15 +6,21 @@
  * 
  * Description:
  *  Implement dynamic language like "message passing" in C++ 
+ *  Behaviours can be learnt while other threads are sending messages
  * ----------------------------------------------------------------------
  * Revision History:
  * 2020-Aug-10	[SV]: Created
+ * 2026-Oct-18	[SV]: Lock-free behaviour table, learn() and forget()
  * ----------------------------------------------------------------------
  */
 #include <iostream>
 #include <string>
 #include <map>
 #include <functional>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "BehaviourTable.h"
 using namespace std;
 
 class Human
@@ -27,8 +33,9 @@ private:
     string name;  // Name of current human
 
     // Map of behaviour ("eat", "sleep") mapped to function pointers or lambdas
-    map<string, Behaviour> messageMap = {
-        {"eat", Behaviour([](auto This, auto food) {    // Lambda
+    // It is copy-on-write, so messages can be sent while behaviours change
+    BehaviourTable<Behaviour> messageMap = {
+        {"eat", Behaviour([](auto &This, auto food) {    // Lambda
                 cout << This.name << " is eating " << food << endl; })
             },
         {"sleep", &Human::sleep} // Function pointer
@@ -54,13 +61,21 @@ public:
     // This is the cor of "message passing" implementation
     auto message(string receiverName, string param)
     {
-        // Check in map if receiver ("eat", "sleep" etc.) exists
-        if (auto receiver = messageMap[receiverName] ) 
-        {
-            receiver(*this, param);
-            return true;
-        }
-        return false;
+        // Check in map if receiver ("eat", "sleep" etc.) exists and call it
+        // This never locks, even if another thread is calling learn()
+        return messageMap.dispatch(receiverName, *this, param);
+    }
+
+    // Teach a new behaviour or replace an existing one at runtime
+    void learn(string receiverName, Behaviour behaviour)
+    {
+        messageMap.learn(receiverName, std::move(behaviour));
+    }
+
+    // Forget a behaviour, return value indicates whether it was known
+    bool forget(string receiverName)
+    {
+        return messageMap.forget(receiverName);
     }
 
     // Sweetness of C++ 😘
@@ -84,5 +99,30 @@ int main(int argc, char **argv, char **envp)
     human("getlost", "forever") 
       || cout << "Human doesn't understand getlost" << endl;
 
+    // Teach a new behaviour and use it
+    human.learn("code", [](auto &, auto language) {
+        cout << "Human is coding in " << language << endl; });
+    human("code", "C++")
+      || cout << "Human doesn't understand code" << endl;
+
+    // Hot-swap "work" while other threads keep sending it
+    atomic<int> oldWork{0}, newWork{0};
+    human.learn("work", [&](auto &, auto) { oldWork++; });
+
+    vector<thread> colleagues;
+    for (int i = 0; i < 4; i++)
+        colleagues.emplace_back([&human] {
+            for (int j = 0; j < 100000; j++)
+                human("work", "hard");
+        });
+
+    for (int swaps = 0; swaps < 1000; swaps++)
+        human.learn("work", [&, swaps](auto &, auto) {
+            (swaps % 2 ? newWork : oldWork)++; });
+
+    for (auto &colleague : colleagues)
+        colleague.join();
+    cout << "Human worked " << oldWork + newWork << " times while learning" << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      CounterBenchmark.c
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Compare ways of counting itemsSold from many sales people
+ *    mutex     - pthread mutex around itemsSold++, as in Mutex.c
+ *    atomic    - one atomic_fetch_add on a single shared counter
+ *    percpu    - ShardedCounter, counterAdd() to the current CPU's slot
+ *    owned     - ShardedCounter, each seller claims a slot, no atomic add
+ *
+ *  Build: gcc -O2 -pthread CounterBenchmark.c ShardedCounter.c -o CounterBenchmark
+ *  Usage: ./CounterBenchmark [maxThreads] [itemsPerThread]
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#include <stdio.h>     // printf()
+#include <stdlib.h>    // atol()
+#include <time.h>      // clock_gettime()
+#include <unistd.h>    // sysconf()
+#include <pthread.h>   // pthread_xxx() functions
+#include <stdatomic.h> // atomic_long
+#include "ShardedCounter.h"
+
+#define MAX_SELLERS 64
+
+typedef enum
+{
+    COUNT_MUTEX,
+    COUNT_ATOMIC,
+    COUNT_PERCPU,
+    COUNT_OWNED,
+    COUNT_KINDS
+} CountKind;
+
+const char *countName[COUNT_KINDS] = {"mutex", "atomic", "percpu", "owned"};
+
+// The different itemsSold counters
+long itemsSold = 0;
+pthread_mutex_t salesCounter = PTHREAD_MUTEX_INITIALIZER;
+atomic_long atomicItemsSold;
+ShardedCounter shardedItemsSold;
+
+CountKind countKind;
+long itemsPerSeller;
+pthread_barrier_t shiftStart;
+
+void *sellItems(void *unused)
+{
+    CounterSlot *mySlot;
+    long i;
+
+    (void)unused;
+    pthread_barrier_wait(&shiftStart);
+
+    switch (countKind)
+    {
+    case COUNT_MUTEX:
+        for (i = 0; i < itemsPerSeller; i++)
+        {
+            pthread_mutex_lock(&salesCounter);
+            itemsSold++;
+            pthread_mutex_unlock(&salesCounter);
+        }
+        break;
+
+    case COUNT_ATOMIC:
+        for (i = 0; i < itemsPerSeller; i++)
+            atomic_fetch_add_explicit(&atomicItemsSold, 1, memory_order_relaxed);
+        break;
+
+    case COUNT_PERCPU:
+        for (i = 0; i < itemsPerSeller; i++)
+            counterAdd(&shardedItemsSold, 1);
+        break;
+
+    case COUNT_OWNED:
+        mySlot = counterClaim(&shardedItemsSold);
+        if (NULL == mySlot)
+        {
+            // No slot left for us, still count on the shared per-CPU slots
+            for (i = 0; i < itemsPerSeller; i++)
+                counterAdd(&shardedItemsSold, 1);
+            break;
+        }
+        for (i = 0; i < itemsPerSeller; i++)
+            counterSlotAdd(mySlot, 1);
+        counterUnclaim(mySlot);
+        break;
+
+    default:
+        break;
+    }
+
+    return NULL;
+}
+
+double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void runShift(CountKind kind, int sellers)
+{
+    pthread_t salesPeople[MAX_SELLERS];
+    double started, elapsed;
+    long total = 0;
+    int i;
+
+    countKind = kind;
+    itemsSold = 0;
+    atomic_store(&atomicItemsSold, 0);
+    if (counterInit(&shardedItemsSold, sellers))
+    {
+        printf("%-8s %4d could not allocate the counter\n", countName[kind], sellers);
+        return;
+    }
+    pthread_barrier_init(&shiftStart, NULL, sellers + 1);
+
+    for (i = 0; i < sellers; i++)
+        pthread_create(&salesPeople[i], NULL, sellItems, NULL);
+
+    pthread_barrier_wait(&shiftStart);
+    started = now();
+    for (i = 0; i < sellers; i++)
+        pthread_join(salesPeople[i], NULL);
+    elapsed = now() - started;
+
+    switch (kind)
+    {
+    case COUNT_MUTEX:
+        total = itemsSold;
+        break;
+    case COUNT_ATOMIC:
+        total = atomic_load(&atomicItemsSold);
+        break;
+    default:
+        total = counterRead(&shardedItemsSold);
+        break;
+    }
+
+    // ns/add is the time each seller spent per item
+    printf("%-8s %4d %14.0f %8.2f %s\n", countName[kind], sellers, total / elapsed,
+           elapsed * 1e9 / total * sellers,
+           total == itemsPerSeller * sellers ? "" : "COUNT MISMATCH");
+
+    pthread_barrier_destroy(&shiftStart);
+    counterDestroy(&shardedItemsSold);
+}
+
+int main(int argc, char **argv)
+{
+    int maxSellers = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int sellers;
+    CountKind kind;
+
+    itemsPerSeller = argc > 2 ? atol(argv[2]) : 2000000;
+    if (maxSellers < 1)
+        maxSellers = 1;
+    if (maxSellers > MAX_SELLERS)
+        maxSellers = MAX_SELLERS;
+
+    printf("%-8s %4s %14s %8s\n", "counter", "thr", "adds/sec", "ns/add");
+
+    for (kind = 0; kind < COUNT_KINDS; kind++)
+        // 1, 2, 4, ... and always maxSellers itself
+        for (sellers = 1; sellers <= maxSellers;
+             sellers = (sellers < maxSellers && sellers * 2 > maxSellers) ? maxSellers : sellers * 2)
+            runShift(kind, sellers);
+
+    return 0;
+}
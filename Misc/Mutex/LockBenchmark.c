@@ -0,0 +1,145 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      LockBenchmark.c
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Benchmark version of sellItems from Mutex.c
+ *  Sales people keep taking the counter for a fixed time, with each
+ *  lock in Locks.h, and we report acquisitions per second and how
+ *  fairly the counter was shared (Jain's index, 1.0 = perfectly fair)
+ *
+ *  Build: gcc -O2 -pthread LockBenchmark.c Locks.c -o LockBenchmark
+ *  Usage: ./LockBenchmark [maxThreads] [milliseconds]
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#include <stdio.h>     // printf()
+#include <stdlib.h>    // atoi()
+#include <time.h>      // clock_gettime(), nanosleep()
+#include <unistd.h>    // sysconf()
+#include <pthread.h>   // pthread_xxx() functions
+#include <stdatomic.h> // atomic_bool
+#include "Locks.h"
+
+#define MAX_SELLERS 64
+
+// Shared resource and the lock protecting it
+long itemsSold = 0;
+Lock salesCounter;
+
+// Set by main when the shift is over
+atomic_bool shiftOver;
+
+// All sellers start together
+pthread_barrier_t shiftStart;
+
+// Each seller counts own sales on their own cache line
+typedef struct
+{
+    _Alignas(CACHE_LINE) pthread_t thread;
+    long sold;
+} SalesPerson;
+
+SalesPerson salesPeople[MAX_SELLERS];
+
+void *sellItems(void *salesPerson)
+{
+    SalesPerson *self = salesPerson;
+    long sold = 0;
+
+    pthread_barrier_wait(&shiftStart);
+
+    // Take the counter, sell one item, give it back, until the shift is over
+    while (!atomic_load_explicit(&shiftOver, memory_order_relaxed))
+    {
+        lockAcquire(&salesCounter);
+        itemsSold++;
+        lockRelease(&salesCounter);
+        sold++;
+    }
+
+    self->sold = sold;
+    return NULL;
+}
+
+double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Run one shift with the given lock and number of sellers
+void runShift(LockKind kind, int sellers, int milliseconds)
+{
+    struct timespec shiftLength = {milliseconds / 1000, (milliseconds % 1000) * 1000000L};
+    double started, elapsed;
+    double sum = 0, sumOfSquares = 0;
+    long fewest = -1, most = 0;
+    int i;
+
+    lockInit(&salesCounter, kind);
+    itemsSold = 0;
+    atomic_store(&shiftOver, 0);
+    pthread_barrier_init(&shiftStart, NULL, sellers + 1);
+
+    for (i = 0; i < sellers; i++)
+        pthread_create(&salesPeople[i].thread, NULL, sellItems, &salesPeople[i]);
+
+    pthread_barrier_wait(&shiftStart);
+    started = now();
+    nanosleep(&shiftLength, NULL);
+    atomic_store(&shiftOver, 1);
+
+    for (i = 0; i < sellers; i++)
+        pthread_join(salesPeople[i].thread, NULL);
+    elapsed = now() - started;
+
+    for (i = 0; i < sellers; i++)
+    {
+        long sold = salesPeople[i].sold;
+        sum += sold;
+        sumOfSquares += (double)sold * sold;
+        if (fewest < 0 || sold < fewest)
+            fewest = sold;
+        if (sold > most)
+            most = sold;
+    }
+
+    printf("%-8s %4d %14.0f %10.3f %12ld %12ld %s\n",
+           lockName(kind), sellers, itemsSold / elapsed,
+           sumOfSquares > 0 ? sum * sum / (sellers * sumOfSquares) : 0.0,
+           fewest, most, itemsSold == (long)sum ? "" : "COUNT MISMATCH");
+
+    pthread_barrier_destroy(&shiftStart);
+    lockDestroy(&salesCounter);
+}
+
+int main(int argc, char **argv)
+{
+    int maxSellers = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int milliseconds = argc > 2 ? atoi(argv[2]) : 200;
+    int sellers;
+    LockKind kind;
+
+    if (maxSellers < 1)
+        maxSellers = 1;
+    if (maxSellers > MAX_SELLERS)
+        maxSellers = MAX_SELLERS;
+
+    printf("%-8s %4s %14s %10s %12s %12s\n",
+           "lock", "thr", "acquires/sec", "fairness", "min/thread", "max/thread");
+
+    for (kind = 0; kind < LOCK_KINDS; kind++)
+        // 1, 2, 4, ... and always maxSellers itself
+        for (sellers = 1; sellers <= maxSellers;
+             sellers = (sellers < maxSellers && sellers * 2 > maxSellers) ? maxSellers : sellers * 2)
+            runShift(kind, sellers, milliseconds);
+
+    return 0;
+}
@@ -0,0 +1,442 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      LockProfiler.c
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Implementation of the lock contention profiler in LockProfiler.h
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef LOCK_PROFILER
+#define LOCK_PROFILER
+#endif
+#include <stdio.h>     // fprintf()
+#include <stdlib.h>    // calloc(), qsort(), atexit()
+#include <string.h>    // memset()
+#include <signal.h>    // sigaction(), sigwait(), SIGUSR1
+#include <time.h>      // clock_gettime()
+#include <stdatomic.h> // atomic_xxx() functions
+#include "LockProfiler.h"
+
+// Bucket b holds times in [2^b, 2^(b+1)) nanoseconds, bucket 0 also holds 0
+#define HISTOGRAM_BUCKETS 40
+
+// (lock, call site) pairs one thread can track, and locks it can hold at once
+#define MAX_SITES 64
+#define MAX_HELD 16
+
+// Number of call sites in the "top waiting" list
+#define TOP_SITES 5
+
+// Statistics for one lock at one call site, written only by the owning thread
+typedef struct
+{
+    pthread_mutex_t *mutex;
+    const char *name;
+    const char *file;
+    int line;
+    atomic_long acquisitions;
+    atomic_long contended;
+    atomic_long waitNs;
+    atomic_long holdNs;
+    atomic_long waitHistogram[HISTOGRAM_BUCKETS];
+    atomic_long holdHistogram[HISTOGRAM_BUCKETS];
+} SiteStats;
+
+// All the statistics of one thread, kept after the thread exits for the report
+typedef struct ThreadStats
+{
+    SiteStats site[MAX_SITES];
+    atomic_int sites; // Entries in site[] which are filled in
+    struct ThreadStats *next;
+} ThreadStats;
+
+// Locks the current thread holds, and when it got them
+typedef struct
+{
+    pthread_mutex_t *mutex;
+    SiteStats *site;
+    long since;
+} HeldLock;
+
+static _Atomic(ThreadStats *) allThreads = NULL;
+static _Thread_local ThreadStats *myStats = NULL;
+static _Thread_local HeldLock held[MAX_HELD];
+static _Thread_local int heldCount = 0;
+
+static pthread_once_t setupOnce = PTHREAD_ONCE_INIT;
+static pthread_t reporter;
+
+static long nowNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+// Only the owning thread writes, so a load and store is enough
+static void bump(atomic_long *counter, long amount)
+{
+    long value = atomic_load_explicit(counter, memory_order_relaxed);
+    atomic_store_explicit(counter, value + amount, memory_order_relaxed);
+}
+
+static int bucketOf(long ns)
+{
+    int bucket = ns > 0 ? 63 - __builtin_clzl((unsigned long)ns) : 0;
+    return bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1;
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Setup and per-thread storage
+ *---------------------------------------------------------------------
+ */
+
+// Prints a report every time SIGUSR1 arrives, even if all other threads are stuck
+static void *reporterMain(void *arg)
+{
+    sigset_t *signals = arg;
+    int signalNumber;
+
+    for (;;)
+        if (0 == sigwait(signals, &signalNumber))
+            profilerReport();
+    return NULL;
+}
+
+// A thread which doesn't block SIGUSR1 got it, pass it on to the reporter
+static void onSignal(int signalNumber)
+{
+    pthread_kill(reporter, signalNumber);
+}
+
+static void setup(void)
+{
+    static sigset_t signals;
+    sigset_t previous;
+    struct sigaction action;
+
+    atexit(profilerReport);
+
+    // Leave SIGUSR1 alone if the program has its own use for it
+    if (0 != sigaction(SIGUSR1, NULL, &action) || SIG_DFL != action.sa_handler)
+        return;
+
+    // The reporter inherits the blocked mask, so only sigwait() takes the signal
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &signals, &previous);
+    if (0 == pthread_create(&reporter, NULL, reporterMain, &signals))
+    {
+        pthread_detach(reporter);
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = onSignal;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGUSR1, &action, NULL);
+    }
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+}
+
+static ThreadStats *threadStats(void)
+{
+    ThreadStats *head;
+
+    if (myStats)
+        return myStats;
+
+    myStats = calloc(1, sizeof(ThreadStats));
+    if (NULL == myStats)
+        return NULL;
+
+    // Lock-free push on the list of all threads
+    head = atomic_load(&allThreads);
+    do
+        myStats->next = head;
+    while (!atomic_compare_exchange_weak(&allThreads, &head, myStats));
+
+    return myStats;
+}
+
+static SiteStats *findSite(pthread_mutex_t *mutex, const char *name, const char *file, int line)
+{
+    ThreadStats *stats = threadStats();
+    SiteStats *site;
+    int sites, i;
+
+    if (NULL == stats)
+        return NULL;
+
+    sites = atomic_load_explicit(&stats->sites, memory_order_relaxed);
+    for (i = 0; i < sites; i++)
+    {
+        site = &stats->site[i];
+        if (site->mutex == mutex && site->line == line && site->file == file)
+            return site;
+    }
+
+    // New call site, no room means it just isn't recorded
+    if (sites == MAX_SITES)
+        return NULL;
+
+    site = &stats->site[sites];
+    site->mutex = mutex;
+    site->name = name;
+    site->file = file;
+    site->line = line;
+
+    // Release so the report sees a filled in entry
+    atomic_store_explicit(&stats->sites, sites + 1, memory_order_release);
+    return site;
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Lock and unlock
+ *---------------------------------------------------------------------
+ */
+int profilerLock(pthread_mutex_t *mutex, const char *name, const char *file, int line)
+{
+    SiteStats *site;
+    long started, acquired;
+    int contended = 0;
+    int result;
+
+    pthread_once(&setupOnce, setup);
+    site = findSite(mutex, name, file, line);
+
+    // If trylock works nobody was holding it, otherwise time the wait
+    started = nowNs();
+    if (0 != pthread_mutex_trylock(mutex))
+    {
+        contended = 1;
+        result = pthread_mutex_lock(mutex);
+        if (result != 0)
+            return result;
+    }
+    acquired = contended ? nowNs() : started;
+
+    if (site)
+    {
+        bump(&site->acquisitions, 1);
+        bump(&site->contended, contended);
+        bump(&site->waitNs, acquired - started);
+        bump(&site->waitHistogram[bucketOf(acquired - started)], 1);
+    }
+
+    if (heldCount < MAX_HELD)
+    {
+        held[heldCount].mutex = mutex;
+        held[heldCount].site = site;
+        held[heldCount].since = acquired;
+        heldCount++;
+    }
+    return 0;
+}
+
+int profilerUnlock(pthread_mutex_t *mutex)
+{
+    int i;
+
+    // Usually the last lock taken is the first released
+    for (i = heldCount - 1; i >= 0; i--)
+    {
+        if (held[i].mutex == mutex)
+        {
+            long holdNs = nowNs() - held[i].since;
+            if (held[i].site)
+            {
+                bump(&held[i].site->holdNs, holdNs);
+                bump(&held[i].site->holdHistogram[bucketOf(holdNs)], 1);
+            }
+            held[i] = held[--heldCount];
+            break;
+        }
+    }
+
+    return pthread_mutex_unlock(mutex);
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Report
+ *---------------------------------------------------------------------
+ */
+
+// Plain copy of SiteStats summed over all threads
+typedef struct
+{
+    pthread_mutex_t *mutex;
+    const char *name;
+    const char *file;
+    int line;
+    long acquisitions;
+    long contended;
+    long waitNs;
+    long holdNs;
+    long waitHistogram[HISTOGRAM_BUCKETS];
+    long holdHistogram[HISTOGRAM_BUCKETS];
+} Totals;
+
+static void addTotals(Totals *total, SiteStats *site)
+{
+    int b;
+
+    total->acquisitions += atomic_load_explicit(&site->acquisitions, memory_order_relaxed);
+    total->contended += atomic_load_explicit(&site->contended, memory_order_relaxed);
+    total->waitNs += atomic_load_explicit(&site->waitNs, memory_order_relaxed);
+    total->holdNs += atomic_load_explicit(&site->holdNs, memory_order_relaxed);
+    for (b = 0; b < HISTOGRAM_BUCKETS; b++)
+    {
+        total->waitHistogram[b] += atomic_load_explicit(&site->waitHistogram[b], memory_order_relaxed);
+        total->holdHistogram[b] += atomic_load_explicit(&site->holdHistogram[b], memory_order_relaxed);
+    }
+}
+
+// Find or add the entry for this lock (line < 0) or call site
+static Totals *totalsFor(Totals *totals, int *count, SiteStats *site, int perSite)
+{
+    int i;
+
+    for (i = 0; i < *count; i++)
+        if (totals[i].mutex == site->mutex &&
+            (!perSite || (totals[i].line == site->line && totals[i].file == site->file)))
+            return &totals[i];
+
+    memset(&totals[*count], 0, sizeof(Totals));
+    totals[*count].mutex = site->mutex;
+    totals[*count].name = site->name;
+    totals[*count].file = site->file;
+    totals[*count].line = perSite ? site->line : -1;
+    return &totals[(*count)++];
+}
+
+static int byWaitNs(const void *left, const void *right)
+{
+    long difference = ((const Totals *)right)->waitNs - ((const Totals *)left)->waitNs;
+    return (difference > 0) - (difference < 0);
+}
+
+// Upper bound of the bucket where the given percentile falls, 0 if empty
+// Locks still held have no hold time yet, so count what was recorded
+static long percentile(long *histogram, int percent)
+{
+    long count = 0, seen = 0;
+    int b;
+
+    for (b = 0; b < HISTOGRAM_BUCKETS; b++)
+        count += histogram[b];
+    if (0 == count)
+        return 0;
+
+    for (b = 0; b < HISTOGRAM_BUCKETS; b++)
+    {
+        seen += histogram[b];
+        if (seen * 100 >= count * percent)
+            return 2L << b;
+    }
+    return 2L << (HISTOGRAM_BUCKETS - 1);
+}
+
+static void printHistogram(const char *label, long *histogram, long count)
+{
+    int b, bar;
+
+    for (b = 0; b < HISTOGRAM_BUCKETS; b++)
+    {
+        if (0 == histogram[b])
+            continue;
+
+        fprintf(stderr, "      %s < %12ld ns %10ld ", label, 2L << b, histogram[b]);
+        for (bar = 0; bar < (int)(40 * histogram[b] / count); bar++)
+            fputc('#', stderr);
+        fputc('\n', stderr);
+    }
+}
+
+void profilerReport(void)
+{
+    ThreadStats *first, *stats;
+    Totals *locks, *sites;
+    int *filled;
+    int lockCount = 0, siteCount = 0, total = 0, threads = 0;
+    int i, t;
+
+    // Other threads keep adding threads and call sites while we report,
+    // so work on a snapshot of the list head and of every thread's count
+    first = atomic_load(&allThreads);
+    for (stats = first; stats; stats = stats->next)
+        threads++;
+    if (0 == threads)
+        return;
+
+    filled = malloc(sizeof(int) * threads);
+    if (NULL == filled)
+        return;
+    for (stats = first, t = 0; t < threads; stats = stats->next, t++)
+    {
+        filled[t] = atomic_load_explicit(&stats->sites, memory_order_acquire);
+        total += filled[t];
+    }
+
+    if (0 == total)
+    {
+        free(filled);
+        return;
+    }
+
+    locks = malloc(sizeof(Totals) * total);
+    sites = malloc(sizeof(Totals) * total);
+    if (NULL == locks || NULL == sites)
+    {
+        free(filled);
+        free(locks);
+        free(sites);
+        return;
+    }
+
+    // At most total entries, as we only look at the sites counted above
+    for (stats = first, t = 0; t < threads; stats = stats->next, t++)
+    {
+        for (i = 0; i < filled[t]; i++)
+        {
+            addTotals(totalsFor(locks, &lockCount, &stats->site[i], 0), &stats->site[i]);
+            addTotals(totalsFor(sites, &siteCount, &stats->site[i], 1), &stats->site[i]);
+        }
+    }
+    free(filled);
+
+    qsort(locks, lockCount, sizeof(Totals), byWaitNs);
+    qsort(sites, siteCount, sizeof(Totals), byWaitNs);
+
+    fprintf(stderr, "\n==== Lock profile ====\n");
+    for (i = 0; i < lockCount; i++)
+    {
+        Totals *lock = &locks[i];
+        long count = lock->acquisitions ? lock->acquisitions : 1;
+
+        fprintf(stderr, "%s (%p)\n", lock->name, (void *)lock->mutex);
+        fprintf(stderr, "    acquisitions %ld, contended %.1f%%, wait total %ld ns, hold total %ld ns\n",
+                lock->acquisitions, 100.0 * lock->contended / count, lock->waitNs, lock->holdNs);
+        fprintf(stderr, "    wait p50 < %ld ns, p99 < %ld ns, hold p50 < %ld ns, p99 < %ld ns\n",
+                percentile(lock->waitHistogram, 50), percentile(lock->waitHistogram, 99),
+                percentile(lock->holdHistogram, 50), percentile(lock->holdHistogram, 99));
+        printHistogram("wait", lock->waitHistogram, count);
+        printHistogram("hold", lock->holdHistogram, count);
+    }
+
+    fprintf(stderr, "Top waiting call sites\n");
+    for (i = 0; i < siteCount && i < TOP_SITES; i++)
+        fprintf(stderr, "    %s:%d %s waited %ld ns over %ld acquisitions (%ld contended)\n",
+                sites[i].file, sites[i].line, sites[i].name, sites[i].waitNs,
+                sites[i].acquisitions, sites[i].contended);
+
+    free(locks);
+    free(sites);
+}
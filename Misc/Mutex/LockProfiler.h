@@ -0,0 +1,57 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      LockProfiler.h
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Drop-in replacement for pthread_mutex_lock/unlock which records,
+ *  per lock and per call site
+ *    - number of acquisitions and how many had to wait (contended)
+ *    - histograms of wait time and hold time (power of 2 nanoseconds)
+ *
+ *  Every thread keeps its own statistics, so recording takes no locks
+ *  and threads don't share cache lines. The report (worst locks, and
+ *  the call sites which waited longest) is written to stderr at exit,
+ *  and by a reporter thread on SIGUSR1, so a deadlocked program can
+ *  still be asked for one. SIGUSR1 is only taken over if the program
+ *  has not installed its own handler before the first profiled lock
+ *
+ *  Compile with -DLOCK_PROFILER and link LockProfiler.c to enable it,
+ *  otherwise the macros are just pthread_mutex_lock/unlock
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef _LOCKPROFILER_H_
+#define _LOCKPROFILER_H_
+
+#include <pthread.h> // pthread_mutex_t
+
+#ifdef LOCK_PROFILER
+
+#define PROFILED_LOCK(mutex) profilerLock((mutex), #mutex, __FILE__, __LINE__)
+#define PROFILED_UNLOCK(mutex) profilerUnlock(mutex)
+
+/*
+ *---------------------------------------------------------------------
+ * Profiler operations
+ *  profilerLock()    - Lock the mutex and record the wait
+ *  profilerUnlock()  - Unlock the mutex and record the hold time
+ *  profilerReport()  - Print what has been recorded so far
+ *---------------------------------------------------------------------
+ */
+int profilerLock(pthread_mutex_t *mutex, const char *name, const char *file, int line);
+int profilerUnlock(pthread_mutex_t *mutex);
+void profilerReport(void);
+
+#else
+
+#define PROFILED_LOCK(mutex) pthread_mutex_lock(mutex)
+#define PROFILED_UNLOCK(mutex) pthread_mutex_unlock(mutex)
+
+#endif
+
+#endif
@@ -0,0 +1,323 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      Locks.c
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Implementation of the spin, ticket, MCS and futex locks in Locks.h
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+#include <unistd.h>      // syscall()
+#include <sys/syscall.h> // SYS_futex
+#include <linux/futex.h> // FUTEX_WAIT, FUTEX_WAKE
+#include <stddef.h>      // NULL
+#include <stdio.h>       // fprintf()
+#include <stdlib.h>      // abort()
+#include "Locks.h"
+
+// Tell the CPU we are spinning, so it can save power and let the sibling run
+#if defined(__x86_64__) || defined(__i386__)
+#define cpuRelax() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define cpuRelax() __asm__ __volatile__("yield")
+#else
+#define cpuRelax() ((void)0)
+#endif
+
+// Backoff limits for TTAS, in pause instructions
+#define BACKOFF_MIN 4
+#define BACKOFF_MAX 1024
+
+// Number of times the futex lock spins before going to sleep
+#define FUTEX_SPINS 100
+
+// Every thread has a few MCS nodes, one per MCS lock it holds
+// Bit i of mcsInUse is set while mcsNodes[i] is queued on some lock
+static _Thread_local McsNode mcsNodes[MCS_MAX_HELD];
+static _Thread_local unsigned mcsInUse = 0;
+
+/*
+ *---------------------------------------------------------------------
+ * LOCK_TTAS
+ *  Spin reading the flag (which stays in our cache) and only try to
+ *  take it when it looks free. If we lose the race, back off for
+ *  twice as long, so losers don't keep hammering the cache line.
+ *---------------------------------------------------------------------
+ */
+static void ttasAcquire(Lock *lock)
+{
+    int backoff = BACKOFF_MIN;
+    int i;
+
+    for (;;)
+    {
+        while (atomic_load_explicit(&lock->flag, memory_order_relaxed))
+            cpuRelax();
+
+        if (!atomic_exchange_explicit(&lock->flag, 1, memory_order_acquire))
+            return;
+
+        for (i = 0; i < backoff; i++)
+            cpuRelax();
+        if (backoff < BACKOFF_MAX)
+            backoff *= 2;
+    }
+}
+
+static void ttasRelease(Lock *lock)
+{
+    atomic_store_explicit(&lock->flag, 0, memory_order_release);
+}
+
+/*
+ *---------------------------------------------------------------------
+ * LOCK_TICKET
+ *  Like the token machine at a bank counter. Take a number and wait
+ *  until it is displayed. Waiters further back pause a little longer.
+ *---------------------------------------------------------------------
+ */
+static void ticketAcquire(Lock *lock)
+{
+    unsigned myTicket = atomic_fetch_add_explicit(&lock->ticket.next, 1, memory_order_relaxed);
+    unsigned serving;
+
+    while ((serving = atomic_load_explicit(&lock->ticket.serving, memory_order_acquire)) != myTicket)
+    {
+        unsigned ahead = myTicket - serving;
+        while (ahead--)
+            cpuRelax();
+    }
+}
+
+static void ticketRelease(Lock *lock)
+{
+    // Only the holder writes serving, so a plain increment is enough
+    unsigned serving = atomic_load_explicit(&lock->ticket.serving, memory_order_relaxed);
+    atomic_store_explicit(&lock->ticket.serving, serving + 1, memory_order_release);
+}
+
+/*
+ *---------------------------------------------------------------------
+ * LOCK_MCS
+ *  Waiters form a linked list. Each one spins on its own node and the
+ *  holder hands the lock to the next node, so a release only touches
+ *  one waiter's cache line instead of all of them.
+ *---------------------------------------------------------------------
+ */
+
+// Locks can be released in any order, so take whichever node is free
+static McsNode *mcsNodeGet(void)
+{
+    unsigned freeNodes = ~mcsInUse & ((1u << MCS_MAX_HELD) - 1);
+    int index;
+
+    if (0 == freeNodes)
+    {
+        fprintf(stderr, "Locks: thread holds more than %d MCS locks, raise MCS_MAX_HELD\n",
+                MCS_MAX_HELD);
+        abort();
+    }
+
+    index = __builtin_ctz(freeNodes);
+    mcsInUse |= 1u << index;
+    return &mcsNodes[index];
+}
+
+static void mcsNodePut(McsNode *node)
+{
+    mcsInUse &= ~(1u << (node - mcsNodes));
+}
+
+static void mcsAcquire(Lock *lock)
+{
+    McsNode *self = mcsNodeGet();
+    McsNode *previous;
+
+    atomic_store_explicit(&self->next, NULL, memory_order_relaxed);
+    atomic_store_explicit(&self->locked, 1, memory_order_relaxed);
+
+    // Join the end of the queue
+    previous = atomic_exchange_explicit(&lock->mcs.tail, self, memory_order_acq_rel);
+    if (previous != NULL)
+    {
+        // Someone is ahead of us, link in and wait for them to wake us
+        atomic_store_explicit(&previous->next, self, memory_order_release);
+        while (atomic_load_explicit(&self->locked, memory_order_acquire))
+            cpuRelax();
+    }
+
+    lock->mcs.holder = self;
+}
+
+static void mcsRelease(Lock *lock)
+{
+    McsNode *self = lock->mcs.holder;
+    McsNode *successor = atomic_load_explicit(&self->next, memory_order_acquire);
+
+    if (NULL == successor)
+    {
+        // Nobody is waiting, try to mark the lock as free
+        McsNode *expected = self;
+        if (atomic_compare_exchange_strong_explicit(&lock->mcs.tail, &expected, NULL,
+                                                    memory_order_release, memory_order_relaxed))
+        {
+            mcsNodePut(self);
+            return;
+        }
+
+        // A waiter has joined but not linked in yet, wait for it
+        while (NULL == (successor = atomic_load_explicit(&self->next, memory_order_acquire)))
+            cpuRelax();
+    }
+
+    atomic_store_explicit(&successor->locked, 0, memory_order_release);
+    mcsNodePut(self);
+}
+
+/*
+ *---------------------------------------------------------------------
+ * LOCK_FUTEX
+ *  Spin briefly in case the holder is about to release it, then sleep
+ *  in the kernel. The unlock path only makes a system call when
+ *  someone is actually sleeping (state 2).
+ *---------------------------------------------------------------------
+ */
+static void futexWait(atomic_int *address, int value)
+{
+    syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static void futexWake(atomic_int *address)
+{
+    syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+static void futexAcquire(Lock *lock)
+{
+    int state = 0;
+    int i;
+
+    // Fast path: lock is free
+    if (atomic_compare_exchange_strong_explicit(&lock->futex, &state, 1,
+                                                memory_order_acquire, memory_order_relaxed))
+        return;
+
+    // Spin for a while, the holder may release it soon
+    for (i = 0; i < FUTEX_SPINS; i++)
+    {
+        state = 0;
+        if (0 == atomic_load_explicit(&lock->futex, memory_order_relaxed) &&
+            atomic_compare_exchange_weak_explicit(&lock->futex, &state, 1,
+                                                  memory_order_acquire, memory_order_relaxed))
+            return;
+        cpuRelax();
+    }
+
+    // Park: mark the lock contended and sleep until woken
+    while (atomic_exchange_explicit(&lock->futex, 2, memory_order_acquire) != 0)
+        futexWait(&lock->futex, 2);
+}
+
+static void futexRelease(Lock *lock)
+{
+    if (atomic_exchange_explicit(&lock->futex, 0, memory_order_release) == 2)
+        futexWake(&lock->futex);
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Common API
+ *---------------------------------------------------------------------
+ */
+void lockInit(Lock *lock, LockKind kind)
+{
+    lock->kind = kind;
+    switch (kind)
+    {
+    case LOCK_PTHREAD:
+        pthread_mutex_init(&lock->mutex, NULL);
+        break;
+    case LOCK_TTAS:
+        atomic_init(&lock->flag, 0);
+        break;
+    case LOCK_TICKET:
+        atomic_init(&lock->ticket.next, 0);
+        atomic_init(&lock->ticket.serving, 0);
+        break;
+    case LOCK_MCS:
+        atomic_init(&lock->mcs.tail, NULL);
+        lock->mcs.holder = NULL;
+        break;
+    case LOCK_FUTEX:
+        atomic_init(&lock->futex, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+void lockAcquire(Lock *lock)
+{
+    switch (lock->kind)
+    {
+    case LOCK_PTHREAD:
+        pthread_mutex_lock(&lock->mutex);
+        break;
+    case LOCK_TTAS:
+        ttasAcquire(lock);
+        break;
+    case LOCK_TICKET:
+        ticketAcquire(lock);
+        break;
+    case LOCK_MCS:
+        mcsAcquire(lock);
+        break;
+    case LOCK_FUTEX:
+        futexAcquire(lock);
+        break;
+    default:
+        break;
+    }
+}
+
+void lockRelease(Lock *lock)
+{
+    switch (lock->kind)
+    {
+    case LOCK_PTHREAD:
+        pthread_mutex_unlock(&lock->mutex);
+        break;
+    case LOCK_TTAS:
+        ttasRelease(lock);
+        break;
+    case LOCK_TICKET:
+        ticketRelease(lock);
+        break;
+    case LOCK_MCS:
+        mcsRelease(lock);
+        break;
+    case LOCK_FUTEX:
+        futexRelease(lock);
+        break;
+    default:
+        break;
+    }
+}
+
+void lockDestroy(Lock *lock)
+{
+    if (LOCK_PTHREAD == lock->kind)
+        pthread_mutex_destroy(&lock->mutex);
+}
+
+const char *lockName(LockKind kind)
+{
+    static const char *names[LOCK_KINDS] = {"pthread", "ttas", "ticket", "mcs", "futex"};
+    return kind < LOCK_KINDS ? names[kind] : "unknown";
+}
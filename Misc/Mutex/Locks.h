@@ -0,0 +1,98 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      Locks.h
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Small lock library, all locks share the same lock/unlock API
+ *
+ *    LOCK_PTHREAD  - pthread_mutex_t, for comparison
+ *    LOCK_TTAS     - Test and test-and-set spinlock with exponential backoff
+ *    LOCK_TICKET   - Ticket lock, threads are served in arrival order
+ *    LOCK_MCS      - MCS queue lock, each waiter spins on its own node
+ *    LOCK_FUTEX    - Spins for a while, then sleeps in the kernel (Linux)
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef _LOCKS_H_
+#define _LOCKS_H_
+
+#include <pthread.h>   // pthread_mutex_t
+#include <stdatomic.h> // atomic_xxx() functions
+
+// Keep hot fields of different locks and waiters on separate cache lines
+#ifndef CACHE_LINE
+#define CACHE_LINE 64
+#endif
+
+// How many MCS locks a single thread may hold at the same time
+// Taking one more aborts the program, at most 32 (one bit per node)
+#define MCS_MAX_HELD 8
+
+typedef enum
+{
+    LOCK_PTHREAD,
+    LOCK_TTAS,
+    LOCK_TICKET,
+    LOCK_MCS,
+    LOCK_FUTEX,
+    LOCK_KINDS // Number of lock kinds, not a lock
+} LockKind;
+
+// Queue node for MCS, every waiting thread spins on its own node
+typedef struct McsNode
+{
+    _Alignas(CACHE_LINE) _Atomic(struct McsNode *) next;
+    atomic_int locked;
+} McsNode;
+
+typedef struct
+{
+    LockKind kind;
+    union
+    {
+        pthread_mutex_t mutex;
+
+        // LOCK_TTAS: 0 = free, 1 = taken
+        atomic_int flag;
+
+        // LOCK_TICKET: take a ticket from next, wait until serving reaches it
+        struct
+        {
+            _Alignas(CACHE_LINE) atomic_uint next;
+            _Alignas(CACHE_LINE) atomic_uint serving;
+        } ticket;
+
+        // LOCK_MCS: last waiter in the queue and the node of the holder
+        struct
+        {
+            _Atomic(McsNode *) tail;
+            McsNode *holder;
+        } mcs;
+
+        // LOCK_FUTEX: 0 = free, 1 = taken, 2 = taken and someone is sleeping
+        atomic_int futex;
+    };
+} Lock;
+
+/*
+ *---------------------------------------------------------------------
+ * Lock operations
+ *  lockInit()      - Prepare a lock of the given kind
+ *  lockAcquire()   - Wait until the lock is ours
+ *  lockRelease()   - Give the lock back
+ *  lockDestroy()   - Release any resources held by the lock
+ *  lockName()      - Printable name of a lock kind
+ *---------------------------------------------------------------------
+ */
+void lockInit(Lock *lock, LockKind kind);
+void lockAcquire(Lock *lock);
+void lockRelease(Lock *lock);
+void lockDestroy(Lock *lock);
+const char *lockName(LockKind kind);
+
+#endif
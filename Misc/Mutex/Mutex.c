@@ -9,6 +9,8 @@
  * ----------------------------------------------------------------------
  * Revision History:
  * 2020-Aug-10	[SV]: Created
+ * 2026-Oct-18	[SV]: Lock calls go through LockProfiler.h
+ * 2026-Oct-18	[SV]: Shifts run on a ThreadPool instead of new threads
  * ----------------------------------------------------------------------
  */
 
@@ -16,6 +18,8 @@
 #include <unistd.h>  // sleep()
 #include <pthread.h> // pthread_xxx() functions
 #include <stdlib.h>  // rand()
+#include "LockProfiler.h" // PROFILED_LOCK(), PROFILED_UNLOCK()
+#include "ThreadPool.h"   // poolXxx(), latchXxx() functions
 
 // Define a shared resource
 int itemsSold = 0;
@@ -23,7 +27,7 @@ int itemsSold = 0;
 // Define a mutex to access itemsSold
 pthread_mutex_t salesCounter = PTHREAD_MUTEX_INITIALIZER;
 
-void *sellItems(void *salesPersonName)
+void sellItems(void *salesPersonName)
 {
     int i;
     int takeBreak;
@@ -33,7 +37,8 @@ void *sellItems(void *salesPersonName)
     sleep(takeBreak);
 
     // The seller must acquire the mutex, sell some items and release the lock
-    pthread_mutex_lock(&salesCounter);
+    // Build with -DLOCK_PROFILER LockProfiler.c to see how much they waited
+    PROFILED_LOCK(&salesCounter);
     printf("\n%s has taken the counter\n", (char *)salesPersonName);
     for (i = 0; i < 3; i++)
     {
@@ -41,29 +46,41 @@ void *sellItems(void *salesPersonName)
         printf("Salesperson %s selling item %d\n", (char *)salesPersonName, itemsSold);
         sleep(2);
     }
-    pthread_mutex_unlock(&salesCounter);
+    PROFILED_UNLOCK(&salesCounter);
 }
 
 int main()
 {
-    // Hire two sales people
-    pthread_t salesPerson1;
-    pthread_t salesPerson2;
+    // Hire two sales people, they come back for every shift
+    // Build with ThreadPool.c
+    ThreadPool salesFloor;
+    Task salesPerson1 = {sellItems, "Ram", NULL, NULL};
+    Task salesPerson2 = {sellItems, "Lakhan", NULL, NULL};
+    Latch shiftOver;
 
     // Number of shifts
     int shift;
 
+    if (poolInit(&salesFloor, 2))
+    {
+        printf("Could not hire the sales people\n");
+        return 1;
+    }
+
     // Ask them to use the same counter to sell items in multiple shifts
     printf("Waiting for sales people to finish selling...\n");
     for (shift = 1; shift < 4; shift++)
     {
-        pthread_create(&salesPerson1, NULL, sellItems, "Ram");
-        pthread_create(&salesPerson2, NULL, sellItems, "Lakhan");
+        latchInit(&shiftOver, 2);
+        salesPerson1.done = &shiftOver;
+        salesPerson2.done = &shiftOver;
+        poolSubmit(&salesFloor, &salesPerson1);
+        poolSubmit(&salesFloor, &salesPerson2);
 
         // Wait for them to finish
-        pthread_join(salesPerson1, NULL);
-        pthread_join(salesPerson2, NULL);
+        latchWait(&shiftOver);
     }
+    poolDestroy(&salesFloor);
 
     printf("\nSales teams has sold %d items\n", itemsSold);
 
@@ -0,0 +1,161 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      PoolBenchmark.c
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Cost of running a shift of short sellItems tasks
+ *    create/join  - pthread_create and pthread_join per seller
+ *    pool         - Submit to a ThreadPool and wait on a Latch
+ *    pool-nested  - One task submits the sellers from inside the pool,
+ *                   so they go to its deque and idle workers steal them
+ *
+ *  Build: gcc -O2 -pthread PoolBenchmark.c ThreadPool.c -o PoolBenchmark
+ *  Usage: ./PoolBenchmark [workers] [shifts]
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#include <stdio.h>     // printf()
+#include <stdlib.h>    // atoi()
+#include <time.h>      // clock_gettime()
+#include <unistd.h>    // sysconf()
+#include <pthread.h>   // pthread_xxx() functions
+#include <stdatomic.h> // atomic_long
+#include "ThreadPool.h"
+
+#define MAX_SELLERS 1000
+
+// Shared resource, a short task only sells one item
+atomic_long itemsSold;
+
+ThreadPool salesFloor;
+Task sellers[MAX_SELLERS];
+pthread_t salesPeople[MAX_SELLERS];
+
+void sellItems(void *unused)
+{
+    (void)unused;
+    atomic_fetch_add_explicit(&itemsSold, 1, memory_order_relaxed);
+}
+
+void *sellItemsThread(void *unused)
+{
+    sellItems(unused);
+    return NULL;
+}
+
+double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Fresh threads for every shift
+void createJoinShift(int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+        pthread_create(&salesPeople[i], NULL, sellItemsThread, NULL);
+    for (i = 0; i < count; i++)
+        pthread_join(salesPeople[i], NULL);
+}
+
+// Same shift on the pool, the latch replaces pthread_join
+void poolShift(int count)
+{
+    Latch shiftOver;
+    int i;
+
+    latchInit(&shiftOver, count);
+    for (i = 0; i < count; i++)
+    {
+        sellers[i].run = sellItems;
+        sellers[i].arg = NULL;
+        sellers[i].done = &shiftOver;
+        poolSubmit(&salesFloor, &sellers[i]);
+    }
+    latchWait(&shiftOver);
+}
+
+// Manager task which hires the sellers from inside the pool
+typedef struct
+{
+    Latch *shiftOver;
+    int count;
+} Hiring;
+
+void hireSellers(void *hiring)
+{
+    // Copy out first, the latch may open before the loop ends
+    Latch *shiftOver = ((Hiring *)hiring)->shiftOver;
+    int count = ((Hiring *)hiring)->count;
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        sellers[i].run = sellItems;
+        sellers[i].arg = NULL;
+        sellers[i].done = shiftOver;
+        poolSubmit(&salesFloor, &sellers[i]);
+    }
+}
+
+void poolNestedShift(int count)
+{
+    Latch shiftOver;
+    Hiring hiring = {&shiftOver, count};
+    Task manager = {hireSellers, &hiring, NULL, NULL};
+
+    latchInit(&shiftOver, count);
+    poolSubmit(&salesFloor, &manager);
+    latchWait(&shiftOver);
+}
+
+void measure(const char *name, void (*shift)(int), int count, int shifts)
+{
+    double started, elapsed;
+    int i;
+
+    atomic_store(&itemsSold, 0);
+    started = now();
+    for (i = 0; i < shifts; i++)
+        shift(count);
+    elapsed = now() - started;
+
+    printf("%-12s %8d %10.2f %s\n", name, count, elapsed * 1e6 / ((double)count * shifts),
+           atomic_load(&itemsSold) == (long)count * shifts ? "" : "COUNT MISMATCH");
+}
+
+int main(int argc, char **argv)
+{
+    int workers = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int shifts = argc > 2 ? atoi(argv[2]) : 2000;
+    int sizes[] = {1, 2, MAX_SELLERS};
+    int i;
+
+    if (poolInit(&salesFloor, workers) != 0)
+    {
+        printf("Could not start the pool\n");
+        return 1;
+    }
+
+    printf("%-12s %8s %10s\n", "method", "sellers", "us/task");
+    for (i = 0; i < (int)(sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        // Keep the total work about the same for every shift size
+        int rounds = shifts / sizes[i] > 10 ? shifts / sizes[i] : 10;
+
+        measure("create/join", createJoinShift, sizes[i], rounds);
+        measure("pool", poolShift, sizes[i], rounds);
+        measure("pool-nested", poolNestedShift, sizes[i], rounds);
+    }
+
+    poolDestroy(&salesFloor);
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      SalesSimulation.cpp
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Simulated version of Mutex.c
+ *  Every salesperson is a coroutine, the counter is an AsyncMutex and
+ *  sleep() advances a virtual clock, so 100K sellers run on one core
+ *
+ *  Build: g++ -std=c++20 -O2 SalesSimulation.cpp -o SalesSimulation
+ *  Usage: ./SalesSimulation [sellers] [shifts]
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "Simulation.h"
+using namespace std;
+
+// Shared resource
+long itemsSold = 0;
+
+// Same behaviour as sellItems in Mutex.c, but waiting costs no real time
+Process sellItems(Simulation &simulation, AsyncMutex &salesCounter, minstd_rand &random)
+{
+    long takeBreak = (random() % 5) + 5;
+    co_await simulation.sleep(takeBreak);
+
+    // The seller must acquire the mutex, sell some items and release the lock
+    co_await salesCounter.lock();
+    for (int i = 0; i < 3; i++)
+    {
+        itemsSold++;
+        co_await simulation.sleep(2);
+    }
+    salesCounter.unlock();
+}
+
+int main(int argc, char **argv)
+{
+    long sellers = argc > 1 ? atol(argv[1]) : 100000;
+    int shifts = argc > 2 ? atoi(argv[2]) : 3;
+
+    Simulation simulation;
+    AsyncMutex salesCounter(simulation);
+    minstd_rand random(2020);
+
+    auto started = chrono::steady_clock::now();
+
+    // Shifts run one after another, like the join loop in Mutex.c
+    for (int shift = 1; shift <= shifts; shift++)
+    {
+        for (long seller = 0; seller < sellers; seller++)
+            simulation.spawn(sellItems(simulation, salesCounter, random));
+        simulation.run();
+    }
+
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - started;
+
+    cout << "Sales teams of " << sellers << " sold " << itemsSold
+         << " items in " << shifts << " shifts" << endl;
+    cout << "Virtual time:  " << simulation.now() << " sec" << endl;
+    cout << "Real time:     " << elapsed.count() << " ms ("
+         << simulation.events() << " events)" << endl;
+    cout << "Counter taken: " << salesCounter.acquisitions << " times, "
+         << salesCounter.contended << " had to wait" << endl;
+    cout << "Waiting:       average " << (salesCounter.contended ? salesCounter.totalWait / salesCounter.contended : 0)
+         << " sec, longest " << salesCounter.longestWait
+         << " sec, longest queue " << salesCounter.longestQueue << endl;
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      ShardedCounter.c
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Implementation of the sharded counter in ShardedCounter.h
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+#include <sched.h>  // sched_getcpu()
+#include <stdlib.h> // aligned_alloc(), free()
+#include <string.h> // memset()
+#include <time.h>   // clock_gettime()
+#include <unistd.h> // sysconf()
+#include "ShardedCounter.h"
+
+static CounterSlot *allocateSlots(int count)
+{
+    CounterSlot *slots = aligned_alloc(CACHE_LINE, sizeof(CounterSlot) * count);
+    int i;
+
+    if (NULL == slots)
+        return NULL;
+
+    memset(slots, 0, sizeof(CounterSlot) * count);
+    for (i = 0; i < count; i++)
+    {
+        atomic_init(&slots[i].value, 0);
+        atomic_init(&slots[i].owned, 0);
+    }
+    return slots;
+}
+
+static long sumSlots(CounterSlot *slots, int count)
+{
+    long sum = 0;
+    int i;
+
+    for (i = 0; i < count; i++)
+        sum += atomic_load_explicit(&slots[i].value, memory_order_relaxed);
+    return sum;
+}
+
+static long nowNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+int counterInit(ShardedCounter *counter, int threadSlots)
+{
+    counter->cpus = (int)sysconf(_SC_NPROCESSORS_CONF);
+    if (counter->cpus < 1)
+        counter->cpus = 1;
+    counter->threads = threadSlots > 0 ? threadSlots : 0;
+
+    counter->cpuSlot = allocateSlots(counter->cpus);
+    counter->threadSlot = counter->threads ? allocateSlots(counter->threads) : NULL;
+    if (NULL == counter->cpuSlot || (counter->threads && NULL == counter->threadSlot))
+    {
+        counterDestroy(counter);
+        return -1;
+    }
+
+    atomic_init(&counter->cachedSeq, 0);
+    atomic_init(&counter->cachedSum, 0);
+    atomic_init(&counter->cachedAt, 0);
+    return 0;
+}
+
+void counterDestroy(ShardedCounter *counter)
+{
+    free(counter->cpuSlot);
+    free(counter->threadSlot);
+    counter->cpuSlot = NULL;
+    counter->threadSlot = NULL;
+}
+
+void counterAdd(ShardedCounter *counter, long amount)
+{
+    // We may be moved to another CPU right after this, which is fine,
+    // the atomic add keeps the count right, we only lose a bit of locality
+    int cpu = sched_getcpu();
+    if (cpu < 0)
+        cpu = 0;
+
+    atomic_fetch_add_explicit(&counter->cpuSlot[cpu % counter->cpus].value,
+                              amount, memory_order_relaxed);
+}
+
+CounterSlot *counterClaim(ShardedCounter *counter)
+{
+    int i;
+
+    for (i = 0; i < counter->threads; i++)
+    {
+        int expected = 0;
+        if (atomic_compare_exchange_strong_explicit(&counter->threadSlot[i].owned, &expected, 1,
+                                                    memory_order_acquire, memory_order_relaxed))
+            return &counter->threadSlot[i];
+    }
+    return NULL;
+}
+
+void counterUnclaim(CounterSlot *slot)
+{
+    // Release so the next owner sees our last value before adding to it
+    atomic_store_explicit(&slot->owned, 0, memory_order_release);
+}
+
+long counterRead(ShardedCounter *counter)
+{
+    // Time it before summing, so the sum is never older than it claims
+    long at = nowNs();
+    long sum = sumSlots(counter->cpuSlot, counter->cpus) +
+               sumSlots(counter->threadSlot, counter->threads);
+    unsigned seq = atomic_load_explicit(&counter->cachedSeq, memory_order_relaxed);
+
+    // Another reader is updating the cache, leave it to them
+    if ((seq & 1) ||
+        !atomic_compare_exchange_strong_explicit(&counter->cachedSeq, &seq, seq + 1,
+                                                 memory_order_relaxed, memory_order_relaxed))
+        return sum;
+    atomic_thread_fence(memory_order_release);
+
+    // A slower reader must not replace a newer sum with its older one
+    if (at > atomic_load_explicit(&counter->cachedAt, memory_order_relaxed))
+    {
+        atomic_store_explicit(&counter->cachedSum, sum, memory_order_relaxed);
+        atomic_store_explicit(&counter->cachedAt, at, memory_order_relaxed);
+    }
+    atomic_store_explicit(&counter->cachedSeq, seq + 2, memory_order_release);
+    return sum;
+}
+
+long counterReadApprox(ShardedCounter *counter, long maxAgeNs)
+{
+    unsigned seq = atomic_load_explicit(&counter->cachedSeq, memory_order_acquire);
+    long sum = atomic_load_explicit(&counter->cachedSum, memory_order_relaxed);
+    long at = atomic_load_explicit(&counter->cachedAt, memory_order_relaxed);
+
+    // Sum and time belong together only if no update ran in between
+    atomic_thread_fence(memory_order_acquire);
+    if (0 == (seq & 1) && seq == atomic_load_explicit(&counter->cachedSeq, memory_order_relaxed) &&
+        nowNs() - at <= maxAgeNs)
+        return sum; // Recent enough, don't touch every slot's cache line
+
+    return counterRead(counter);
+}
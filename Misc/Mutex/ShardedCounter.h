@@ -0,0 +1,86 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      ShardedCounter.h
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Counter split into cache-line sized slots, so threads incrementing
+ *  it don't fight over one cache line (or one mutex like itemsSold)
+ *
+ *  Two ways to add:
+ *    counterAdd()      - Any thread, goes to the slot of the current CPU
+ *                        using a relaxed atomic add
+ *    counterSlotAdd()  - Thread which claimed its own slot, plain load
+ *                        and store, no atomic read-modify-write at all
+ *
+ *  Reading sums all the slots, counterReadApprox() reuses a recent sum
+ *  Its clock is CLOCK_MONOTONIC_COARSE, which only ticks every 1-4 ms,
+ *  so a maxAgeNs shorter than a tick is no stricter than one tick
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef _SHARDEDCOUNTER_H_
+#define _SHARDEDCOUNTER_H_
+
+#include <stdatomic.h> // atomic_xxx() functions
+
+#ifndef CACHE_LINE
+#define CACHE_LINE 64
+#endif
+
+// One slot per cache line
+typedef struct
+{
+    _Alignas(CACHE_LINE) atomic_long value;
+    atomic_int owned; // Only used by thread slots
+} CounterSlot;
+
+typedef struct
+{
+    int cpus;                // Number of per-CPU slots
+    int threads;             // Number of slots threads can claim
+    CounterSlot *cpuSlot;    // Shared per-CPU slots, updated atomically
+    CounterSlot *threadSlot; // Slots owned by one thread each
+
+    // Last sum, for counterReadApprox()
+    // cachedSeq is odd while a reader is updating the pair (a seqlock)
+    _Alignas(CACHE_LINE) atomic_uint cachedSeq;
+    atomic_long cachedSum;
+    atomic_long cachedAt; // Nanoseconds, CLOCK_MONOTONIC_COARSE, before summing
+} ShardedCounter;
+
+/*
+ *---------------------------------------------------------------------
+ * Counter operations
+ *  counterInit()       - Allocate slots, 0 on success, -1 on failure
+ *  counterDestroy()    - Free the slots
+ *  counterAdd()        - Add to the current CPU's slot
+ *  counterClaim()      - Get a slot for this thread only, NULL if none left
+ *  counterSlotAdd()    - Add to a claimed slot
+ *  counterUnclaim()    - Give a claimed slot back, its count is kept
+ *  counterRead()       - Exact sum of all slots
+ *  counterReadApprox() - Sum which may be up to maxAgeNs old, give or
+ *                        take one tick of the coarse clock
+ *---------------------------------------------------------------------
+ */
+int counterInit(ShardedCounter *counter, int threadSlots);
+void counterDestroy(ShardedCounter *counter);
+void counterAdd(ShardedCounter *counter, long amount);
+CounterSlot *counterClaim(ShardedCounter *counter);
+void counterUnclaim(CounterSlot *slot);
+long counterRead(ShardedCounter *counter);
+long counterReadApprox(ShardedCounter *counter, long maxAgeNs);
+
+// Only the owning thread writes this slot, so no atomic add is needed
+// Readers still see a whole value as it is a relaxed atomic store
+static inline void counterSlotAdd(CounterSlot *slot, long amount)
+{
+    long value = atomic_load_explicit(&slot->value, memory_order_relaxed);
+    atomic_store_explicit(&slot->value, value + amount, memory_order_relaxed);
+}
+
+#endif
@@ -0,0 +1,301 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      Simulation.h
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Discrete event simulation using C++20 coroutines
+ *
+ *  Instead of one OS thread per salesperson, each one is a coroutine.
+ *  When it waits (for the counter or for time to pass) it suspends and
+ *  the event loop runs someone else. Time is a virtual clock, so a
+ *  sleep of 2 seconds costs nothing in real time.
+ *
+ *    Simulation  - Event loop and virtual clock
+ *    Process     - Coroutine type for a simulated thread
+ *    AsyncMutex  - Awaitable mutex, waiters are served in FIFO order
+ *
+ *  Needs C++20: g++ -std=c++20
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef _SIMULATION_H_
+#define _SIMULATION_H_
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <queue>
+#include <utility>
+#include <vector>
+using namespace std;
+
+class Simulation;
+
+/**
+ * Process is the return type of a simulated thread
+ * It starts suspended, Simulation::spawn() schedules it,
+ * and its frame is freed as soon as it finishes
+ * A Process which is never spawned frees its frame when it goes away
+ */
+class Process
+{
+public:
+    struct promise_type
+    {
+        // Set by spawn(), the Simulation links all unfinished processes
+        Simulation *simulation = nullptr;
+        promise_type *previous = nullptr;
+        promise_type *next = nullptr;
+
+        Process get_return_object()
+        {
+            return Process(coroutine_handle<promise_type>::from_promise(*this));
+        }
+        suspend_always initial_suspend() noexcept { return {}; }
+        suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { terminate(); }
+
+        // Runs when the frame is freed, finished or destroyed
+        ~promise_type();
+    };
+
+    Process(Process &&other) noexcept : handle(exchange(other.handle, nullptr)) {}
+    Process &operator=(Process &&) = delete;
+
+    ~Process()
+    {
+        if (handle)
+            handle.destroy();
+    }
+
+private:
+    friend class Simulation;
+    coroutine_handle<promise_type> handle;
+
+    explicit Process(coroutine_handle<promise_type> handle) : handle(handle) {}
+};
+
+/**
+ * Simulation holds the virtual clock and the events waiting to run
+ *
+ *  spawn()   - Start a process at the current time
+ *  sleep()   - Awaitable, resumes the process after some virtual time
+ *  run()     - Run events until there are none left
+ *  now()     - Current virtual time
+ *
+ * It owns every process it spawned, the ones which have not finished
+ * (still sleeping, or waiting on an AsyncMutex after a deadlock) are
+ * destroyed with it. Don't use an AsyncMutex after its Simulation is gone
+ */
+class Simulation
+{
+    // Something to resume at a given time, seq keeps equal times in FIFO order
+    struct Event
+    {
+        long time;
+        long seq;
+        coroutine_handle<> process;
+
+        bool operator>(const Event &other) const
+        {
+            return time != other.time ? time > other.time : seq > other.seq;
+        }
+    };
+
+private:
+    long clock = 0;
+    long nextSeq = 0;
+    long eventsRun = 0;
+
+    // Processes ready to run now, and processes waiting for a later time
+    deque<coroutine_handle<>> ready;
+    priority_queue<Event, vector<Event>, greater<Event>> timers;
+
+    // Every spawned process which has not finished, wherever it waits
+    Process::promise_type *live = nullptr;
+
+    friend struct Process::promise_type;
+
+    void forget(Process::promise_type *process)
+    {
+        if (process->previous)
+            process->previous->next = process->next;
+        else
+            live = process->next;
+        if (process->next)
+            process->next->previous = process->previous;
+    }
+
+public:
+    Simulation() = default;
+    Simulation(const Simulation &) = delete;
+    Simulation &operator=(const Simulation &) = delete;
+
+    // Free processes which never got to finish, each one unlinks itself
+    ~Simulation()
+    {
+        while (live)
+            coroutine_handle<Process::promise_type>::from_promise(*live).destroy();
+    }
+
+    long now() const { return clock; }
+    long events() const { return eventsRun; }
+
+    void spawn(Process process)
+    {
+        auto handle = exchange(process.handle, nullptr);
+        auto &promise = handle.promise();
+
+        promise.simulation = this;
+        promise.next = live;
+        if (live)
+            live->previous = &promise;
+        live = &promise;
+
+        ready.push_back(handle);
+    }
+
+    // Resume a suspended process at the current time
+    void wake(coroutine_handle<> process)
+    {
+        ready.push_back(process);
+    }
+
+    // Awaitable which resumes after delay units of virtual time
+    auto sleep(long delay)
+    {
+        struct Sleep
+        {
+            Simulation &simulation;
+            long delay;
+
+            bool await_ready() const noexcept { return delay <= 0; }
+            void await_suspend(coroutine_handle<> process)
+            {
+                simulation.timers.push({simulation.clock + delay, simulation.nextSeq++, process});
+            }
+            void await_resume() const noexcept {}
+        };
+        return Sleep{*this, delay};
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            // Run everything which is ready at the current time
+            while (!ready.empty())
+            {
+                auto process = ready.front();
+                ready.pop_front();
+                eventsRun++;
+                process.resume();
+            }
+
+            if (timers.empty())
+                break;
+
+            // Jump the clock to the next timer and make all timers due then ready
+            clock = timers.top().time;
+            while (!timers.empty() && timers.top().time == clock)
+            {
+                ready.push_back(timers.top().process);
+                timers.pop();
+            }
+        }
+    }
+};
+
+inline Process::promise_type::~promise_type()
+{
+    if (simulation)
+        simulation->forget(this);
+}
+
+/**
+ * AsyncMutex is a mutex for processes
+ * lock() is awaited, so a waiting process suspends instead of blocking
+ * unlock() hands the mutex straight to the first waiter
+ */
+class AsyncMutex
+{
+    struct Waiter
+    {
+        coroutine_handle<> process;
+        long since;
+    };
+
+private:
+    Simulation &simulation;
+    bool locked = false;
+    deque<Waiter> waiters;
+
+public:
+    // Statistics, in virtual time
+    long acquisitions = 0;
+    long contended = 0;
+    long totalWait = 0;
+    long longestWait = 0;
+    size_t longestQueue = 0;
+
+    AsyncMutex(Simulation &simulation) : simulation(simulation) {}
+
+    auto lock()
+    {
+        struct Lock
+        {
+            AsyncMutex &mutex;
+
+            // Free, take it without suspending
+            bool await_ready() noexcept
+            {
+                if (mutex.locked)
+                    return false;
+                mutex.locked = true;
+                mutex.acquisitions++;
+                return true;
+            }
+
+            // Taken, join the queue
+            void await_suspend(coroutine_handle<> process)
+            {
+                mutex.waiters.push_back({process, mutex.simulation.now()});
+                mutex.contended++;
+                if (mutex.waiters.size() > mutex.longestQueue)
+                    mutex.longestQueue = mutex.waiters.size();
+            }
+
+            void await_resume() const noexcept {}
+        };
+        return Lock{*this};
+    }
+
+    void unlock()
+    {
+        if (waiters.empty())
+        {
+            locked = false;
+            return;
+        }
+
+        // Stay locked, ownership passes to the first waiter
+        Waiter next = waiters.front();
+        waiters.pop_front();
+
+        long waited = simulation.now() - next.since;
+        totalWait += waited;
+        if (waited > longestWait)
+            longestWait = waited;
+        acquisitions++;
+
+        simulation.wake(next.process);
+    }
+};
+
+#endif
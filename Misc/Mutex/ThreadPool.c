@@ -0,0 +1,363 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      ThreadPool.c
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Implementation of the thread pool and latch in ThreadPool.h
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#define _GNU_SOURCE
+#include <stdlib.h>      // aligned_alloc(), free(), rand_r()
+#include <string.h>      // memset()
+#include <sched.h>       // sched_yield()
+#include <limits.h>      // INT_MAX
+#include <unistd.h>      // syscall()
+#include <sys/syscall.h> // SYS_futex
+#include <linux/futex.h> // FUTEX_WAIT, FUTEX_WAKE
+#include "ThreadPool.h"
+
+// How many times an idle worker or latch waiter looks again before sleeping
+#define IDLE_SPINS 2000
+
+// Set in Latch.count while somebody sleeps in latchWait()
+#define LATCH_SLEEPING (1 << 30)
+
+// Worker running on the current thread, NULL outside the pool
+static _Thread_local Worker *currentWorker = NULL;
+
+/*
+ *---------------------------------------------------------------------
+ * Chase-Lev work-stealing deque
+ *  dequePush()   - Owner adds at bottom, 0 if the deque is full
+ *  dequeTake()   - Owner removes from bottom (newest task first)
+ *  dequeSteal()  - Other workers remove from top (oldest task first)
+ *---------------------------------------------------------------------
+ */
+static int dequePush(Deque *deque, Task *task)
+{
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+
+    if (bottom - top >= DEQUE_SIZE)
+        return 0;
+
+    atomic_store_explicit(&deque->task[bottom & (DEQUE_SIZE - 1)], task, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return 1;
+}
+
+static Task *dequeTake(Deque *deque)
+{
+    long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    long top;
+    Task *task = NULL;
+
+    // Reserve the bottom slot before looking at top
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top <= bottom)
+    {
+        task = atomic_load_explicit(&deque->task[bottom & (DEQUE_SIZE - 1)], memory_order_relaxed);
+        if (top == bottom)
+        {
+            // Last task, race thieves for it
+            if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                         memory_order_seq_cst, memory_order_relaxed))
+                task = NULL;
+            atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        }
+    }
+    else
+    {
+        // Empty, undo the reservation
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return task;
+}
+
+static Task *dequeSteal(Deque *deque)
+{
+    long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    long bottom;
+    Task *task;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom)
+        return NULL;
+
+    task = atomic_load_explicit(&deque->task[top & (DEQUE_SIZE - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        return NULL; // Lost to the owner or another thief
+
+    return task;
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Shared queue for tasks submitted from outside the pool
+ *---------------------------------------------------------------------
+ */
+static void queuePush(ThreadPool *pool, Task *task)
+{
+    task->next = NULL;
+    pthread_mutex_lock(&pool->queueLock);
+    if (pool->queueTail)
+        pool->queueTail->next = task;
+    else
+        atomic_store_explicit(&pool->queueHead, task, memory_order_relaxed);
+    pool->queueTail = task;
+    pthread_mutex_unlock(&pool->queueLock);
+}
+
+static Task *queuePop(ThreadPool *pool)
+{
+    Task *task;
+
+    pthread_mutex_lock(&pool->queueLock);
+    task = atomic_load_explicit(&pool->queueHead, memory_order_relaxed);
+    if (task)
+    {
+        atomic_store_explicit(&pool->queueHead, task->next, memory_order_relaxed);
+        if (NULL == task->next)
+            pool->queueTail = NULL;
+    }
+    pthread_mutex_unlock(&pool->queueLock);
+    return task;
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Workers
+ *---------------------------------------------------------------------
+ */
+
+// Own deque first, then the shared queue, then steal from someone else
+static Task *findTask(Worker *self)
+{
+    ThreadPool *pool = self->pool;
+    Task *task;
+    int start, i;
+
+    if ((task = dequeTake(&self->deque)))
+        return task;
+
+    // Only take the lock if the shared queue looks non-empty
+    if (atomic_load_explicit(&pool->queueHead, memory_order_relaxed) && (task = queuePop(pool)))
+        return task;
+
+    start = rand_r(&self->seed) % pool->workers;
+    for (i = 0; i < pool->workers; i++)
+    {
+        Worker *victim = &pool->worker[(start + i) % pool->workers];
+        if (victim != self && (task = dequeSteal(&victim->deque)))
+            return task;
+    }
+    return NULL;
+}
+
+static void *workerMain(void *arg)
+{
+    Worker *self = arg;
+    ThreadPool *pool = self->pool;
+    int idle = 0;
+
+    currentWorker = self;
+
+    while (!atomic_load_explicit(&pool->stop, memory_order_acquire))
+    {
+        Task *task = findTask(self);
+        if (task)
+        {
+            atomic_fetch_sub(&pool->pending, 1);
+
+            // Read done first, the task may be reused as soon as the latch opens
+            Latch *done = task->done;
+            task->run(task->arg);
+            if (done)
+                latchCountDown(done);
+            idle = 0;
+            continue;
+        }
+
+        // Nothing to do, look again for a while before going to sleep
+        if (++idle < IDLE_SPINS)
+        {
+            if (0 == idle % 64)
+                sched_yield();
+            continue;
+        }
+
+        // seq_cst on sleepers and pending, so either we see the new task
+        // or poolSubmit() sees us sleeping and wakes us up
+        pthread_mutex_lock(&pool->sleepLock);
+        atomic_fetch_add(&pool->sleepers, 1);
+        while (0 == atomic_load(&pool->pending) && !atomic_load(&pool->stop))
+            pthread_cond_wait(&pool->wakeUp, &pool->sleepLock);
+        atomic_fetch_sub(&pool->sleepers, 1);
+        pthread_mutex_unlock(&pool->sleepLock);
+        idle = 0;
+    }
+
+    currentWorker = NULL;
+    return NULL;
+}
+
+// Tell the first started workers to stop and wait for them to exit
+static void stopWorkers(ThreadPool *pool, int started)
+{
+    int i;
+
+    atomic_store(&pool->stop, 1);
+    pthread_mutex_lock(&pool->sleepLock);
+    pthread_cond_broadcast(&pool->wakeUp);
+    pthread_mutex_unlock(&pool->sleepLock);
+
+    for (i = 0; i < started; i++)
+        pthread_join(pool->worker[i].thread, NULL);
+}
+
+static void freePool(ThreadPool *pool)
+{
+    pthread_cond_destroy(&pool->wakeUp);
+    pthread_mutex_destroy(&pool->sleepLock);
+    pthread_mutex_destroy(&pool->queueLock);
+    free(pool->worker);
+    pool->worker = NULL;
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Pool API
+ *---------------------------------------------------------------------
+ */
+int poolInit(ThreadPool *pool, int workers)
+{
+    int i;
+
+    memset(pool, 0, sizeof(*pool));
+    pool->workers = workers > 0 ? workers : 1;
+    pool->worker = aligned_alloc(CACHE_LINE, sizeof(Worker) * pool->workers);
+    if (NULL == pool->worker)
+        return -1;
+    memset(pool->worker, 0, sizeof(Worker) * pool->workers);
+
+    pthread_mutex_init(&pool->queueLock, NULL);
+    pthread_mutex_init(&pool->sleepLock, NULL);
+    pthread_cond_init(&pool->wakeUp, NULL);
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->sleepers, 0);
+    atomic_init(&pool->stop, 0);
+
+    for (i = 0; i < pool->workers; i++)
+    {
+        Worker *worker = &pool->worker[i];
+        atomic_init(&worker->deque.top, 0);
+        atomic_init(&worker->deque.bottom, 0);
+        worker->pool = pool;
+        worker->seed = i + 1;
+    }
+
+    // Running workers read pool->workers, so it never changes after this
+    for (i = 0; i < pool->workers; i++)
+    {
+        if (pthread_create(&pool->worker[i].thread, NULL, workerMain, &pool->worker[i]))
+        {
+            // Could not start all workers, stop the ones we have
+            stopWorkers(pool, i);
+            freePool(pool);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void poolSubmit(ThreadPool *pool, Task *task)
+{
+    // Count it first, so pending never goes below 0 when a worker is quick
+    atomic_fetch_add(&pool->pending, 1);
+
+    // Inside a task of this pool, keep the work local
+    if (NULL == currentWorker || currentWorker->pool != pool ||
+        !dequePush(&currentWorker->deque, task))
+        queuePush(pool, task);
+
+    // Only make the system call if a worker is actually asleep
+    if (atomic_load(&pool->sleepers) > 0)
+    {
+        pthread_mutex_lock(&pool->sleepLock);
+        pthread_cond_signal(&pool->wakeUp);
+        pthread_mutex_unlock(&pool->sleepLock);
+    }
+}
+
+void poolDestroy(ThreadPool *pool)
+{
+    stopWorkers(pool, pool->workers);
+    freePool(pool);
+}
+
+/*
+ *---------------------------------------------------------------------
+ * Latch API
+ *---------------------------------------------------------------------
+ */
+static void futexWait(atomic_int *address, int value)
+{
+    syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+}
+
+static void futexWake(atomic_int *address)
+{
+    syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+void latchInit(Latch *latch, int count)
+{
+    atomic_init(&latch->count, count);
+}
+
+void latchCountDown(Latch *latch)
+{
+    int previous = atomic_fetch_sub(&latch->count, 1);
+
+    // We opened the latch, wake anyone who went to sleep waiting for it
+    // Only the address is passed to the kernel, the waiter may already
+    // have returned and reused the latch
+    if (previous == (LATCH_SLEEPING | 1))
+        futexWake(&latch->count);
+}
+
+void latchWait(Latch *latch)
+{
+    int count;
+    int i;
+
+    // Small tasks finish quickly, so look a few times before sleeping
+    for (i = 0; i < IDLE_SPINS; i++)
+    {
+        if (0 == (atomic_load_explicit(&latch->count, memory_order_acquire) & ~LATCH_SLEEPING))
+            return;
+        if (0 == i % 64)
+            sched_yield();
+    }
+
+    // Mark that we are sleeping and sleep until the count reaches 0
+    while ((count = atomic_load(&latch->count)) & ~LATCH_SLEEPING)
+    {
+        if (!(count & LATCH_SLEEPING) &&
+            !atomic_compare_exchange_weak(&latch->count, &count, count | LATCH_SLEEPING))
+            continue;
+        futexWait(&latch->count, count | LATCH_SLEEPING);
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * ----------------------------------------------------------------------
+ * File:      ThreadPool.h
+ * Project:   Mutex
+ * Author:    Sanjay Vyas
+ *
+ * Description:
+ *  Fixed size pool of worker threads which are created once and reused,
+ *  instead of calling pthread_create/pthread_join for every shift
+ *
+ *    - Each worker has its own work-stealing deque (Chase-Lev)
+ *      Tasks submitted by a worker go to its own deque, idle workers
+ *      steal from the other end of busy workers' deques
+ *    - Tasks submitted from outside the pool go to a shared queue
+ *    - A Latch lets the submitter wait until a group of tasks is done,
+ *      which replaces pthread_join at the end of a shift
+ *
+ *  Tasks are owned by the caller, the pool never allocates per task
+ * ----------------------------------------------------------------------
+ * Revision History:
+ * 2026-Oct-18	[SV]: Created
+ * ----------------------------------------------------------------------
+ */
+
+#ifndef _THREADPOOL_H_
+#define _THREADPOOL_H_
+
+#include <pthread.h>   // pthread_xxx() functions
+#include <stdatomic.h> // atomic_xxx() functions
+
+#ifndef CACHE_LINE
+#define CACHE_LINE 64
+#endif
+
+// Capacity of each worker's deque, must be a power of 2
+#define DEQUE_SIZE 1024
+
+/**
+ * Latch counts down to zero once, latchWait() returns when it gets there
+ * A high bit of count is set when somebody sleeps in latchWait(), so
+ * the last latchCountDown() knows whether it has to wake anyone
+ */
+typedef struct
+{
+    atomic_int count;
+} Latch;
+
+/**
+ * Task is a function and its argument, filled in by the caller
+ * If done is set, the pool counts it down after run() returns
+ */
+typedef struct Task
+{
+    void (*run)(void *arg);
+    void *arg;
+    Latch *done;
+    struct Task *next; // Used by the pool for the shared queue
+} Task;
+
+// Work-stealing deque, owner works at bottom, thieves take from top
+typedef struct
+{
+    _Alignas(CACHE_LINE) atomic_long top;
+    _Alignas(CACHE_LINE) atomic_long bottom;
+    _Atomic(Task *) task[DEQUE_SIZE];
+} Deque;
+
+struct ThreadPool;
+
+typedef struct
+{
+    Deque deque;
+    pthread_t thread;
+    struct ThreadPool *pool;
+    unsigned seed; // For picking a victim to steal from
+} Worker;
+
+typedef struct ThreadPool
+{
+    int workers;
+    Worker *worker;
+
+    // Tasks submitted from outside the pool
+    pthread_mutex_t queueLock;
+    _Atomic(Task *) queueHead; // Workers peek at it without the lock
+    Task *queueTail;
+
+    // Idle workers sleep here until there is something to do
+    _Alignas(CACHE_LINE) atomic_long pending; // Tasks queued but not yet taken
+    atomic_int sleepers;
+    atomic_int stop;
+    pthread_mutex_t sleepLock;
+    pthread_cond_t wakeUp;
+} ThreadPool;
+
+/*
+ *---------------------------------------------------------------------
+ * Pool operations
+ *  poolInit()      - Start the workers, 0 on success, -1 if any of
+ *                    them could not be started (none are left running)
+ *  poolSubmit()    - Queue a task, can be called from inside tasks too
+ *  poolDestroy()   - Stop and join the workers, queued tasks are dropped
+ *
+ * Latch operations
+ *  latchInit()       - Set the count
+ *  latchCountDown()  - Decrement the count, wake waiters when it is 0
+ *  latchWait()       - Wait until the count is 0, the latch can be
+ *                      reused or go out of scope as soon as it returns
+ *---------------------------------------------------------------------
+ */
+int poolInit(ThreadPool *pool, int workers);
+void poolSubmit(ThreadPool *pool, Task *task);
+void poolDestroy(ThreadPool *pool);
+
+void latchInit(Latch *latch, int count);
+void latchCountDown(Latch *latch);
+void latchWait(Latch *latch);
+
+#endif